@@ -3,6 +3,7 @@ package com.example.ava.audio
 import android.Manifest
 import android.media.AudioFormat
 import android.media.AudioRecord
+import android.media.AudioTimestamp
 import android.media.MediaRecorder
 import android.media.audiofx.AcousticEchoCanceler
 import android.media.audiofx.AutomaticGainControl
@@ -24,6 +25,14 @@ class MicrophoneInput(
     private var aec: AcousticEchoCanceler? = null
     private var agc: AutomaticGainControl? = null
     private var ns: NoiseSuppressor? = null
+    private val timestamp = AudioTimestamp()
+    private var samplesRead = 0L
+    private var anchorSampleIndex = 0L
+    private var anchorNanos = 0L
+
+    /** Index, counted from [start], of the first sample in the buffer last returned by [read]. */
+    var readSampleIndex = 0L
+        private set
     
     val isRecording get() = audioRecord?.recordingState == AudioRecord.RECORDSTATE_RECORDING
 
@@ -32,6 +41,11 @@ class MicrophoneInput(
         if (audioRecord == null) {
             audioRecord = createAudioRecord()
             setupAudioEffects()
+            // A new AudioRecord's frame positions start again at 0.
+            samplesRead = 0
+            readSampleIndex = 0
+            anchorSampleIndex = 0
+            anchorNanos = 0
         }
         if (!isRecording) {
             Log.d(TAG, "Starting microphone with AEC=${aec != null}, AGC=${agc != null}, NS=${ns != null}")
@@ -50,9 +64,28 @@ class MicrophoneInput(
             "error reading audio, read: $read"
         }
         buffer.limit(read)
+        readSampleIndex = samplesRead
+        samplesRead += read / BYTES_PER_SAMPLE
+        updateSampleClock(audioRecord)
         return buffer
     }
 
+    /** CLOCK_MONOTONIC ([System.nanoTime]) time at which the sample at [sampleIndex] was captured. */
+    fun sampleTimeNanos(sampleIndex: Long): Long =
+        anchorNanos + (sampleIndex - anchorSampleIndex) * 1_000_000_000L / sampleRateInHz
+
+    // Prefers the capture time the audio HAL reports for a frame position.
+    // Without one, the last sample read is assumed to have been captured now.
+    private fun updateSampleClock(audioRecord: AudioRecord) {
+        if (audioRecord.getTimestamp(timestamp, AudioTimestamp.TIMEBASE_MONOTONIC) == AudioRecord.SUCCESS) {
+            anchorSampleIndex = timestamp.framePosition
+            anchorNanos = timestamp.nanoTime
+        } else {
+            anchorSampleIndex = samplesRead
+            anchorNanos = System.nanoTime()
+        }
+    }
+
     @RequiresPermission(Manifest.permission.RECORD_AUDIO)
     private fun createAudioRecord(): AudioRecord {
         val audioRecord = AudioRecord(
@@ -120,5 +153,6 @@ class MicrophoneInput(
         const val DEFAULT_SAMPLE_RATE_IN_HZ = 16000
         const val DEFAULT_CHANNEL_CONFIG = AudioFormat.CHANNEL_IN_MONO
         const val DEFAULT_AUDIO_FORMAT = AudioFormat.ENCODING_PCM_16BIT
+        private const val BYTES_PER_SAMPLE = 2
     }
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+package com.example.ava.audio
+
+import android.util.Log
+import com.example.ava.utils.LatencyHistogram
+
+/**
+ * Wake latency histograms, all measured on CLOCK_MONOTONIC ([System.nanoTime]) from the
+ * capture time of the last sample of the feature frame that completed a model input:
+ *
+ * - [Stage.FEATURES]: until the frontend reported the input tensor ready.
+ * - [Stage.INFERENCE]: until every model had run on it and updated its sliding window.
+ * - [Stage.DETECTION]: until a wake word detected on that frame was emitted.
+ * - [Stage.ARBITRATION]: duration of the multi-device arbitration round, on its own.
+ * - [Stage.REQUEST]: until the voice assistant start request was written to the socket.
+ */
+object WakeLatencyTracer {
+    private const val TAG = "WakeLatencyTracer"
+
+    // A start request this long after the last wake was not caused by it.
+    private const val MAX_REQUEST_DELAY_NS = 10_000_000_000L
+
+    enum class Stage {
+        FEATURES,
+        INFERENCE,
+        DETECTION,
+        ARBITRATION,
+        REQUEST
+    }
+
+    private val histograms = Stage.entries.associateWith { LatencyHistogram() }
+
+    @Volatile
+    private var pendingWakeNanos = 0L
+
+    fun record(stage: Stage, nanos: Long) {
+        histograms.getValue(stage).record(nanos)
+    }
+
+    /** Records the detection latency and arms the request stage for this wake. */
+    fun onWakeDetected(audioTimestampNanos: Long) {
+        record(Stage.DETECTION, System.nanoTime() - audioTimestampNanos)
+        pendingWakeNanos = audioTimestampNanos
+    }
+
+    fun onRequestSent() {
+        val audioTimestampNanos = pendingWakeNanos
+        if (audioTimestampNanos == 0L)
+            return
+        pendingWakeNanos = 0L
+        val latency = System.nanoTime() - audioTimestampNanos
+        if (latency > MAX_REQUEST_DELAY_NS)
+            return
+        record(Stage.REQUEST, latency)
+        Log.d(TAG, "Wake to request ${latency / 1000} us; ${summary()}")
+    }
+
+    fun percentiles(stage: Stage): LatencyHistogram.Percentiles =
+        histograms.getValue(stage).percentiles()
+
+    fun summary(): String = Stage.entries.joinToString(" ") { stage ->
+        val p = percentiles(stage)
+        "${stage.name.lowercase()}[n=${p.count} p50=${p.p50Us} p95=${p.p95Us} p99=${p.p99Us}]"
+    }
+
+    fun reset() {
+        for (histogram in histograms.values)
+            histogram.reset()
+        pendingWakeNanos = 0L
+    }
+}
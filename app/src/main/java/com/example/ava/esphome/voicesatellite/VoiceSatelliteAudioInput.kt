@@ -3,7 +3,9 @@ package com.example.ava.esphome.voicesatellite
 import android.Manifest
 import androidx.annotation.RequiresPermission
 import com.example.ava.audio.MicrophoneInput
+import com.example.ava.audio.WakeLatencyTracer
 import com.example.ava.microwakeword.WakeWordDetector
+import com.example.ava.microwakeword.WakeWordPipeline
 import com.example.ava.microwakeword.WakeWordProvider
 import com.google.protobuf.ByteString
 import kotlinx.coroutines.ExperimentalCoroutinesApi
@@ -26,6 +28,10 @@ class VoiceSatelliteAudioInput(
     val availableStopWords by lazy { stopWordProvider.getWakeWords() }
     private var currentWakeWordDetector: WakeWordDetector? = null
 
+    // Frontend noise estimate carried over from the last pipeline, so unmuting
+    // does not re-adapt to the room from silence.
+    private var frontendState: ByteArray? = null
+
     private val _activeWakeWords = MutableStateFlow(activeWakeWords)
     val activeWakeWords = _activeWakeWords.asStateFlow()
     fun setActiveWakeWords(value: List<String>) {
@@ -61,7 +67,11 @@ class VoiceSatelliteAudioInput(
 
     sealed class AudioResult {
         data class Audio(val audio: ByteString) : AudioResult()
-        data class WakeDetected(val wakeWord: String, val wakeWordId: String = "") : AudioResult()
+        data class WakeDetected(
+            val wakeWord: String,
+            val wakeWordId: String = "",
+            val audioTimestampNanos: Long = 0L
+        ) : AudioResult()
         data class StopDetected(val stopWord: String) : AudioResult()
     }
 
@@ -75,11 +85,13 @@ class VoiceSatelliteAudioInput(
             var wakeWords = activeWakeWords.value
             var stopWords = activeStopWords.value
 
-            val wakeWordDetector = WakeWordDetector(wakeWordProvider).apply {
+            val wakeWordPipeline = WakeWordPipeline()
+            frontendState?.let { wakeWordPipeline.restoreState(it) }
+            val wakeWordDetector = wakeWordPipeline.createDetector(wakeWordProvider).apply {
                 setActiveWakeWords(wakeWords)
             }
             currentWakeWordDetector = wakeWordDetector
-            val stopWordDetector = WakeWordDetector(stopWordProvider).apply {
+            val stopWordDetector = wakeWordPipeline.createDetector(stopWordProvider).apply {
                 setActiveWakeWords(stopWords)
             }
             try {
@@ -118,17 +130,28 @@ class VoiceSatelliteAudioInput(
 
                     
                     
-                    val wakeDetections = wakeWordDetector.detect(audio)
+                    val firstSampleIndex = microphoneInput.readSampleIndex
+                    wakeWordPipeline.process(audio) { sample ->
+                        microphoneInput.sampleTimeNanos(firstSampleIndex + sample)
+                    }
                     audio.rewind()
+
+                    val wakeDetections = wakeWordDetector.takeDetections()
                     if (wakeDetections.isNotEmpty()) {
                         
                         for (detection in wakeDetections) {
-                            emit(AudioResult.WakeDetected(detection.wakeWordPhrase, detection.wakeWordId))
+                            WakeLatencyTracer.onWakeDetected(detection.audioTimestampNanos)
+                            emit(
+                                AudioResult.WakeDetected(
+                                    detection.wakeWordPhrase,
+                                    detection.wakeWordId,
+                                    detection.audioTimestampNanos
+                                )
+                            )
                         }
                     }
 
-                    val stopDetections = stopWordDetector.detect(audio)
-                    audio.rewind()
+                    val stopDetections = stopWordDetector.takeDetections()
                     if (stopDetections.isNotEmpty()) {
                         emit(AudioResult.StopDetected(stopDetections.first().wakeWordPhrase))
                     }
@@ -139,8 +162,8 @@ class VoiceSatelliteAudioInput(
                 }
             } finally {
                 microphoneInput.close()
-                wakeWordDetector.close()
-                stopWordDetector.close()
+                frontendState = wakeWordPipeline.saveState()
+                wakeWordPipeline.close()
             }
         }
     }
@@ -35,6 +35,11 @@ class VoiceSatelliteDiagnostics(
     private var batteryLevelEntity: SensorEntity? = null
     private var batteryVoltageEntity: SensorEntity? = null
     private var chargingStatusEntity: TextSensorEntity? = null
+    private var frontendTimeEntity: SensorEntity? = null
+    private var frontendMaxTimeEntity: SensorEntity? = null
+    private var noiseSuppressorTimeEntity: SensorEntity? = null
+    private var noiseSuppressorMaxTimeEntity: SensorEntity? = null
+    private var droppedAudioFramesEntity: SensorEntity? = null
     private var intentLauncherStatusEntity: TextSensorEntity? = null
 
     companion object {
@@ -42,7 +47,9 @@ class VoiceSatelliteDiagnostics(
     }
 
     fun init(settings: ExperimentalSettings) {
-        diagnosticSensorManager = com.example.ava.sensors.DiagnosticSensorManager(context, scope)
+        diagnosticSensorManager = com.example.ava.sensors.DiagnosticSensorManager(
+            context, scope, settings.diagnosticAudioTimingEnabled
+        )
         diagnosticSensorManager?.start()
         
         addDiagnosticEntities(settings)
@@ -67,6 +74,13 @@ class VoiceSatelliteDiagnostics(
         if (settings.diagnosticBatteryLevelEnabled) batteryLevelEntity?.updateState(manager.batteryLevel.value.toFloat())
         if (settings.diagnosticBatteryVoltageEnabled) batteryVoltageEntity?.updateState(manager.batteryVoltage.value)
         if (settings.diagnosticChargingStatusEnabled) chargingStatusEntity?.updateState(manager.chargingStatus.value)
+        if (settings.diagnosticAudioTimingEnabled) {
+            frontendTimeEntity?.updateState(manager.frontendTimeUs.value)
+            frontendMaxTimeEntity?.updateState(manager.frontendMaxTimeUs.value)
+            noiseSuppressorTimeEntity?.updateState(manager.noiseSuppressorTimeUs.value)
+            noiseSuppressorMaxTimeEntity?.updateState(manager.noiseSuppressorMaxTimeUs.value)
+            droppedAudioFramesEntity?.updateState(manager.droppedAudioFrames.value.toFloat())
+        }
     }
     
     private fun addDiagnosticEntities(settings: ExperimentalSettings) {
@@ -163,6 +177,57 @@ class VoiceSatelliteDiagnostics(
             )
             device.addEntity(chargingStatusEntity!!)
         }
+        if (settings.diagnosticAudioTimingEnabled) {
+            frontendTimeEntity = SensorEntity(
+                key = "frontend_time".hashCode(),
+                name = context.getString(R.string.entity_frontend_time),
+                objectId = "frontend_time",
+                icon = "mdi:timer-outline",
+                unitOfMeasurement = "µs",
+                accuracyDecimals = 1,
+                entityCategory = EntityCategory.ENTITY_CATEGORY_DIAGNOSTIC
+            )
+            device.addEntity(frontendTimeEntity!!)
+            frontendMaxTimeEntity = SensorEntity(
+                key = "frontend_max_time".hashCode(),
+                name = context.getString(R.string.entity_frontend_max_time),
+                objectId = "frontend_max_time",
+                icon = "mdi:timer-alert-outline",
+                unitOfMeasurement = "µs",
+                accuracyDecimals = 1,
+                entityCategory = EntityCategory.ENTITY_CATEGORY_DIAGNOSTIC
+            )
+            device.addEntity(frontendMaxTimeEntity!!)
+            noiseSuppressorTimeEntity = SensorEntity(
+                key = "noise_suppressor_time".hashCode(),
+                name = context.getString(R.string.entity_noise_suppressor_time),
+                objectId = "noise_suppressor_time",
+                icon = "mdi:timer-outline",
+                unitOfMeasurement = "µs",
+                accuracyDecimals = 1,
+                entityCategory = EntityCategory.ENTITY_CATEGORY_DIAGNOSTIC
+            )
+            device.addEntity(noiseSuppressorTimeEntity!!)
+            noiseSuppressorMaxTimeEntity = SensorEntity(
+                key = "noise_suppressor_max_time".hashCode(),
+                name = context.getString(R.string.entity_noise_suppressor_max_time),
+                objectId = "noise_suppressor_max_time",
+                icon = "mdi:timer-alert-outline",
+                unitOfMeasurement = "µs",
+                accuracyDecimals = 1,
+                entityCategory = EntityCategory.ENTITY_CATEGORY_DIAGNOSTIC
+            )
+            device.addEntity(noiseSuppressorMaxTimeEntity!!)
+            droppedAudioFramesEntity = SensorEntity(
+                key = "dropped_audio_frames".hashCode(),
+                name = context.getString(R.string.entity_dropped_audio_frames),
+                objectId = "dropped_audio_frames",
+                icon = "mdi:waveform",
+                accuracyDecimals = 0,
+                entityCategory = EntityCategory.ENTITY_CATEGORY_DIAGNOSTIC
+            )
+            device.addEntity(droppedAudioFramesEntity!!)
+        }
         if (settings.diagnosticKillAppEnabled) {
             device.addEntity(ButtonEntity(
                 key = "kill_app".hashCode(),
@@ -1,6 +1,8 @@
 package com.example.ava.microwakeword
 
 import android.util.Log
+import com.example.microfeatures.MicroFrontend
+import org.tensorflow.lite.DataType
 import org.tensorflow.lite.Interpreter
 import java.nio.ByteBuffer
 import java.lang.RuntimeException
@@ -10,7 +12,6 @@ private const val SAMPLES_PER_CHUNK = 160
 private const val BYTES_PER_SAMPLE = 2  
 private const val BYTES_PER_CHUNK = SAMPLES_PER_CHUNK * BYTES_PER_SAMPLE
 private const val SECONDS_PER_CHUNK = SAMPLES_PER_CHUNK / SAMPLES_PER_SECOND
-private const val STRIDE = 3
 private const val DEFAULT_REFRACTORY_SECONDS = 0.3f
 private const val CHUNKS_PER_SECOND = SAMPLES_PER_SECOND.toFloat() / SAMPLES_PER_CHUNK
 
@@ -41,7 +42,7 @@ class MicroWakeWord(
                 interpreter?.allocateTensors()
                 val inputDetails = interpreter!!.getInputTensor(0)
                 val inputQuantParams = inputDetails.quantizationParams()
-                inputTensorBuffer = TensorBuffer.create(
+                inputTensorBuffer = TensorBuffer(
                     inputDetails.dataType(),
                     inputDetails.shape(),
                     inputQuantParams.scale,
@@ -64,27 +65,32 @@ class MicroWakeWord(
         }
     }
 
-    fun processAudioFeatures(features: FloatArray): Boolean {
-        if (features.isEmpty())
-            return false
-
+    /**
+     * Lets [frontend] quantize features straight into this model's input tensor.
+     * Returns the tensor id reported in [MicroFrontend.processAudioToTensors]'s ready mask.
+     */
+    fun registerTensorOutput(frontend: MicroFrontend, consumer: Int): Int {
         initializeIfNeeded()
-
-        if (!isInitialized) {
-            Log.w(TAG, "Interpreter not initialized, returning false")
-            return false
+        val tensorBuffer = inputTensorBuffer ?: error("Interpreter not initialized for $id")
+        val dataType = when (tensorBuffer.dataType) {
+            DataType.FLOAT32 -> MicroFrontend.TENSOR_TYPE_FLOAT32
+            DataType.UINT8 -> MicroFrontend.TENSOR_TYPE_UINT8
+            DataType.INT8 -> MicroFrontend.TENSOR_TYPE_INT8
+            else -> error("Unsupported data type: ${tensorBuffer.dataType}")
         }
+        return frontend.addTensorOutput(
+            consumer,
+            tensorBuffer.directBuffer,
+            dataType,
+            tensorBuffer.scale,
+            tensorBuffer.zeroPoint
+        )
+    }
 
+    /** Runs inference on an input tensor that the native frontend reported as complete. */
+    fun processFilledTensor(): Boolean {
         val tensorBuffer = inputTensorBuffer ?: return false
-        if (features.size * STRIDE != tensorBuffer.flatSize)
-            error("Unexpected feature size ${features.size} for stride $STRIDE and tensor size ${tensorBuffer.flatSize}")
-
-        tensorBuffer.put(features)
-        if (!tensorBuffer.isComplete)
-            return false
-
-        val probability = getWakeWordProbability(tensorBuffer.getTensor())
-        tensorBuffer.clear()
+        val probability = getWakeWordProbability(tensorBuffer.getFilledTensor())
         return isWakeWordDetected(probability)
     }
 
@@ -1,44 +1,51 @@
 package com.example.ava.microwakeword
 
 import android.util.Log
-import com.example.ava.utils.fillFrom
 import com.example.microfeatures.MicroFrontend
-import java.nio.ByteBuffer
 
-private const val SAMPLES_PER_SECOND = 16000
-private const val SAMPLES_PER_CHUNK = 160  
-private const val BYTES_PER_SAMPLE = 2  
-private const val BYTES_PER_CHUNK = SAMPLES_PER_CHUNK * BYTES_PER_SAMPLE
-
-class WakeWordDetector(private val wakeWordProvider: WakeWordProvider) : AutoCloseable {
-    private val frontend = MicroFrontend()
-    private val buffer = ByteBuffer.allocateDirect(BYTES_PER_CHUNK)
+/**
+ * A set of wake word models fed by a [MicroFrontend] that may be shared with other
+ * detectors; see [WakeWordPipeline].
+ */
+class WakeWordDetector(
+    private val wakeWordProvider: WakeWordProvider,
+    private val frontend: MicroFrontend
+) : AutoCloseable {
+    private val consumer = frontend.addConsumer()
     private val wakeWords by lazy { wakeWordProvider.getWakeWords() }
     private var activeWakeWords = listOf<MicroWakeWord>()
+    private var tensorIds = IntArray(0)
+    private var detections: MutableList<DetectionResult>? = null
 
+    /** [audioTimestampNanos] is the capture time of the frame the wake word was detected on. */
     data class DetectionResult(
         val wakeWordId: String,
-        val wakeWordPhrase: String
+        val wakeWordPhrase: String,
+        val audioTimestampNanos: Long = 0L
     )
 
-    fun detect(audio: ByteBuffer): List<DetectionResult> {
-        val detections = mutableListOf<DetectionResult>()
-        buffer.fillFrom(audio)
-        while (buffer.flip().remaining() == BYTES_PER_CHUNK) {
-            val processOutput = frontend.processSamples(buffer)
-            buffer.position(buffer.position() + processOutput.samplesRead * BYTES_PER_SAMPLE)
-            buffer.compact()
-            buffer.fillFrom(audio)
-            if (processOutput.features.isEmpty())
+    /**
+     * Runs every model whose input tensor is flagged in [readyMask]; [frameNanos] is the
+     * capture time of the frame that completed them.
+     */
+    fun onTensorsReady(readyMask: Int, frameNanos: Long = System.nanoTime()) {
+        for (index in activeWakeWords.indices) {
+            if (readyMask and (1 shl tensorIds[index]) == 0)
                 continue
-            for (wakeWord in activeWakeWords) {
-                val result = wakeWord.processAudioFeatures(processOutput.features)
-                if (result && !detections.any { it.wakeWordId == wakeWord.id })
-                    detections.add(DetectionResult(wakeWord.id, wakeWord.wakeWord))
-            }
+            val wakeWord = activeWakeWords[index]
+            if (!wakeWord.processFilledTensor())
+                continue
+            val found = detections ?: mutableListOf<DetectionResult>().also { detections = it }
+            if (!found.any { it.wakeWordId == wakeWord.id })
+                found.add(DetectionResult(wakeWord.id, wakeWord.wakeWord, frameNanos))
         }
-        buffer.compact()
-        return detections
+    }
+
+    /** Returns and clears the detections made since the last call. */
+    fun takeDetections(): List<DetectionResult> {
+        val found = detections ?: return emptyList()
+        detections = null
+        return found
     }
 
     fun setActiveWakeWords(wakeWordIds: List<String>) {
@@ -62,16 +69,22 @@ class WakeWordDetector(private val wakeWordProvider: WakeWordProvider) : AutoClo
                 )
             }
         }
+        frontend.clearConsumer(consumer)
+        tensorIds = IntArray(activeWakeWords.size) {
+            activeWakeWords[it].registerTensorOutput(frontend, consumer)
+        }
     }
 
     fun reset() {
         for (wakeWord in activeWakeWords) {
             wakeWord.reset()
         }
+        frontend.resetConsumer(consumer)
+        detections = null
     }
 
     override fun close() {
-        frontend.close()
+        frontend.removeConsumer(consumer)
         for (model in activeWakeWords)
             model.close()
     }
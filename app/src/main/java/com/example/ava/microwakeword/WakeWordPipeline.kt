@@ -0,0 +1,77 @@
+package com.example.ava.microwakeword
+
+import android.os.Debug
+import android.util.Log
+import com.example.ava.audio.WakeLatencyTracer
+import com.example.microfeatures.MicroFrontend
+import java.nio.ByteBuffer
+
+/**
+ * Runs a single [MicroFrontend] and fans each feature frame out to every detector created
+ * from it, so the wake word and stop word sets no longer compute identical features twice.
+ */
+class WakeWordPipeline : AutoCloseable {
+    private val frontend = MicroFrontend()
+    private val detectors = mutableListOf<WakeWordDetector>()
+
+    init {
+        logNativeMemory("created")
+    }
+
+    fun createDetector(wakeWordProvider: WakeWordProvider): WakeWordDetector {
+        val detector = WakeWordDetector(wakeWordProvider, frontend)
+        detectors.add(detector)
+        return detector
+    }
+
+    /**
+     * Processes the whole buffer; collect results with [WakeWordDetector.takeDetections].
+     * [sampleTimeNanos] maps a sample's offset in [audio] to its capture time, which is
+     * carried with each detection and used for the [WakeLatencyTracer] stages.
+     */
+    fun process(audio: ByteBuffer, sampleTimeNanos: (Int) -> Long = { System.nanoTime() }) {
+        val start = audio.position()
+        while (audio.hasRemaining()) {
+            val readyMask = frontend.processAudioToTensors(audio)
+            if (readyMask == 0)
+                break
+            // The frame that completed the tensors ends at the current position.
+            val frameNanos = sampleTimeNanos((audio.position() - start) / BYTES_PER_SAMPLE - 1)
+            WakeLatencyTracer.record(WakeLatencyTracer.Stage.FEATURES, System.nanoTime() - frameNanos)
+            for (detector in detectors)
+                detector.onTensorsReady(readyMask, frameNanos)
+            WakeLatencyTracer.record(WakeLatencyTracer.Stage.INFERENCE, System.nanoTime() - frameNanos)
+        }
+    }
+
+    /** Adapted frontend state to hand to the next pipeline; see [MicroFrontend.saveState]. */
+    fun saveState(): ByteArray = frontend.saveState()
+
+    fun restoreState(state: ByteArray) {
+        if (!frontend.restoreState(state))
+            Log.w(TAG, "Discarding incompatible frontend state (${state.size} bytes)")
+    }
+
+    override fun close() {
+        for (detector in detectors)
+            detector.close()
+        detectors.clear()
+        frontend.close()
+        logNativeMemory("closed")
+    }
+
+    private fun logNativeMemory(event: String) {
+        Log.d(
+            TAG,
+            "Pipeline $event: frontends=${MicroFrontend.liveFrontendCount()} " +
+                "frontendBytes=${MicroFrontend.nativeBytesInUse()} " +
+                "kernels=${frontend.kernelVariant} " +
+                "nativeHeap=${Debug.getNativeHeapAllocatedSize()}"
+        )
+    }
+
+    companion object {
+        private const val TAG = "WakeWordPipeline"
+        private const val BYTES_PER_SAMPLE = 2
+    }
+}
@@ -1,6 +1,7 @@
 package com.example.ava.multidevice
 
 import android.util.Log
+import com.example.ava.audio.WakeLatencyTracer
 import kotlinx.coroutines.Dispatchers
 import kotlinx.coroutines.withContext
 import kotlinx.coroutines.withTimeoutOrNull
@@ -24,6 +25,7 @@ data class ArbiterResult(
 )
 
 suspend fun arbitrateWakeWord(wakeWordId: String, timestamp: Long = System.currentTimeMillis()): ArbiterResult {
+    val startNanos = System.nanoTime()
     return withContext(Dispatchers.IO) {
         var socket: DatagramSocket? = null
         try {
@@ -55,6 +57,8 @@ suspend fun arbitrateWakeWord(wakeWordId: String, timestamp: Long = System.curre
         } finally {
             socket?.close()
         }
+    }.also {
+        WakeLatencyTracer.record(WakeLatencyTracer.Stage.ARBITRATION, System.nanoTime() - startNanos)
     }
 }
 
@@ -12,6 +12,7 @@ import android.os.Environment
 import android.os.StatFs
 import android.os.SystemClock
 import android.util.Log
+import com.example.microfeatures.NativeStats
 import kotlinx.coroutines.*
 import kotlinx.coroutines.flow.MutableStateFlow
 import kotlinx.coroutines.flow.StateFlow
@@ -20,7 +21,8 @@ import java.net.NetworkInterface
 
 class DiagnosticSensorManager(
     private val context: Context,
-    private val scope: CoroutineScope
+    private val scope: CoroutineScope,
+    private val audioTimingEnabled: Boolean = false
 ) {
     companion object {
         private const val TAG = "DiagnosticSensorManager"
@@ -53,6 +55,21 @@ class DiagnosticSensorManager(
     private val _chargingStatus = MutableStateFlow("None")
     val chargingStatus: StateFlow<String> = _chargingStatus
     
+    private val _frontendTimeUs = MutableStateFlow(0f)
+    val frontendTimeUs: StateFlow<Float> = _frontendTimeUs
+    
+    private val _frontendMaxTimeUs = MutableStateFlow(0f)
+    val frontendMaxTimeUs: StateFlow<Float> = _frontendMaxTimeUs
+    
+    private val _noiseSuppressorTimeUs = MutableStateFlow(0f)
+    val noiseSuppressorTimeUs: StateFlow<Float> = _noiseSuppressorTimeUs
+    
+    private val _noiseSuppressorMaxTimeUs = MutableStateFlow(0f)
+    val noiseSuppressorMaxTimeUs: StateFlow<Float> = _noiseSuppressorMaxTimeUs
+    
+    private val _droppedAudioFrames = MutableStateFlow(0L)
+    val droppedAudioFrames: StateFlow<Long> = _droppedAudioFrames
+    
     private var updateJob: Job? = null
     private val wifiSamples = mutableListOf<Int>()
     private val memorySamples = mutableListOf<Float>()
@@ -99,6 +116,34 @@ class DiagnosticSensorManager(
         updateStorageFree()
         updateMemoryUsage()
         updateBattery()
+        if (audioTimingEnabled) {
+            updateAudioTiming()
+        }
+    }
+    
+    // Mean and max per 10 ms frame over the last update interval. The native
+    // counters are reset after each read so the max reflects recent spikes.
+    // The frontend max is the sum of its two stages' maxima, an upper bound.
+    // Dropped frames keep counting up for the lifetime of the service.
+    private fun updateAudioTiming() {
+        try {
+            val stats = NativeStats.snapshot()
+            NativeStats.reset()
+            val frontend = stats.getValue(NativeStats.Stage.FRONTEND)
+            val tensorWrite = stats.getValue(NativeStats.Stage.TENSOR_WRITE)
+            val process = stats.getValue(NativeStats.Stage.NOISE_PROCESS)
+            if (frontend.frames > 0) {
+                _frontendTimeUs.value = (frontend.meanNs + tensorWrite.meanNs) / 1000f
+                _frontendMaxTimeUs.value = (frontend.maxNs + tensorWrite.maxNs) / 1000f
+            }
+            if (process.frames > 0) {
+                _noiseSuppressorTimeUs.value = process.meanNs / 1000f
+                _noiseSuppressorMaxTimeUs.value = process.maxNs / 1000f
+            }
+            _droppedAudioFrames.value += stats.values.sumOf { it.droppedFrames }
+        } catch (e: Exception) {
+            Log.w(TAG, "Failed to read native timing", e)
+        }
     }
     
     private fun updateBattery() {
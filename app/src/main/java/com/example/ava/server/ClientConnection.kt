@@ -1,8 +1,10 @@
 package com.example.ava.server
 
 import android.util.Log
+import com.example.ava.audio.WakeLatencyTracer
 import com.example.esphomeproto.MESSAGE_PARSERS
 import com.example.esphomeproto.MESSAGE_TYPES
+import com.example.esphomeproto.api.VoiceAssistantRequest
 import com.google.protobuf.MessageLite
 import kotlinx.coroutines.Dispatchers
 import kotlinx.coroutines.flow.catch
@@ -141,6 +143,8 @@ class ClientConnection(private val socket: Socket) : AutoCloseable {
                     outputStream.write(byteStream.toByteArray())
                     outputStream.flush()
                 }
+                if (message is VoiceAssistantRequest && message.start)
+                    WakeLatencyTracer.onRequestSent()
             } catch (e: IOException) {
                 if (!isClosed.get())
                     Log.e(TAG, "Error writing to socket", e)
@@ -67,6 +67,7 @@ data class ExperimentalSettings(
     val diagnosticBatteryLevelEnabled: Boolean = false,
     val diagnosticBatteryVoltageEnabled: Boolean = false,
     val diagnosticChargingStatusEnabled: Boolean = false,
+    val diagnosticAudioTimingEnabled: Boolean = false,
     
     val intentLauncherEnabled: Boolean = false,
     val intentLauncherHaDisplayEnabled: Boolean = false,
@@ -309,6 +310,12 @@ class ExperimentalSettingsStore(context: Context) : SettingsStoreImpl<Experiment
         update { it.copy(diagnosticChargingStatusEnabled = enabled) }
     }
     
+    val diagnosticAudioTimingEnabled: Flow<Boolean> = getFlow().map { it.diagnosticAudioTimingEnabled }
+    
+    suspend fun setDiagnosticAudioTimingEnabled(enabled: Boolean) {
+        update { it.copy(diagnosticAudioTimingEnabled = enabled) }
+    }
+    
     val intentLauncherEnabled: Flow<Boolean> = getFlow().map { it.intentLauncherEnabled }
     val intentLauncherHaDisplayEnabled: Flow<Boolean> = getFlow().map { it.intentLauncherHaDisplayEnabled }
     
@@ -201,6 +201,22 @@ fun DiagnosticSettingsScreen(
                         }
                     )
                 }
+                
+                SettingsDivider()
+                
+                SettingRow(
+                    label = stringResource(R.string.settings_diagnostic_audio_timing)
+                ) {
+                    ModernSwitch(
+                        checked = experimentalState?.diagnosticAudioTimingEnabled ?: false,
+                        onCheckedChange = {
+                            coroutineScope.launch {
+                                viewModel.saveDiagnosticAudioTimingEnabled(it)
+                                restartService()
+                            }
+                        }
+                    )
+                }
             }
         }
     }
@@ -137,13 +137,14 @@ fun ServiceSettingsScreen(
                     experimentalState?.diagnosticRebootEnabled ?: false,
                     experimentalState?.diagnosticBatteryLevelEnabled ?: false,
                     experimentalState?.diagnosticBatteryVoltageEnabled ?: false,
-                    experimentalState?.diagnosticChargingStatusEnabled ?: false
+                    experimentalState?.diagnosticChargingStatusEnabled ?: false,
+                    experimentalState?.diagnosticAudioTimingEnabled ?: false
                 ).count { it }
                 
                 SettingRow(
                     label = stringResource(R.string.settings_diagnostic_sensor),
                     subLabel = if (diagnosticEnabled) 
-                        stringResource(R.string.settings_diagnostic_sensor_desc) + " ($enabledCount/10)"
+                        stringResource(R.string.settings_diagnostic_sensor_desc) + " ($enabledCount/11)"
                     else 
                         stringResource(R.string.settings_diagnostic_sensor_desc)
                 ) {
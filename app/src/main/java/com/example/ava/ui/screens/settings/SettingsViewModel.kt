@@ -394,6 +394,10 @@ class SettingsViewModel(application: Application) : AndroidViewModel(application
         experimentalSettingsStore.setDiagnosticChargingStatusEnabled(enabled)
     }
     
+    suspend fun saveDiagnosticAudioTimingEnabled(enabled: Boolean) {
+        experimentalSettingsStore.setDiagnosticAudioTimingEnabled(enabled)
+    }
+    
     suspend fun saveIntentLauncherEnabled(enabled: Boolean) {
         experimentalSettingsStore.setIntentLauncherEnabled(enabled)
     }
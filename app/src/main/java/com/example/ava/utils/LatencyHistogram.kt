@@ -0,0 +1,82 @@
+package com.example.ava.utils
+
+import kotlin.math.ceil
+
+/**
+ * Fixed-size latency histogram in microseconds with eight sub-buckets per power of two,
+ * so any percentile is reported within 12.5% of the true value. Values above about an
+ * hour land in the last bucket.
+ */
+class LatencyHistogram {
+    data class Percentiles(
+        val count: Long,
+        val p50Us: Long,
+        val p95Us: Long,
+        val p99Us: Long,
+        val maxUs: Long
+    )
+
+    private val counts = LongArray(BUCKET_COUNT)
+    private var count = 0L
+    private var maxUs = 0L
+
+    @Synchronized
+    fun record(nanos: Long) {
+        val us = (nanos / 1000).coerceIn(0, MAX_US)
+        counts[bucketOf(us)]++
+        count++
+        if (us > maxUs) maxUs = us
+    }
+
+    /** Upper bound of the bucket holding the [fraction] quantile, or 0 if nothing was recorded. */
+    @Synchronized
+    fun percentile(fraction: Double): Long {
+        if (count == 0L)
+            return 0
+        // Nearest rank: the smallest value with at least fraction * count samples at or below it.
+        val rank = ceil(fraction * count).toLong().coerceIn(1, count)
+        var seen = 0L
+        for (bucket in counts.indices) {
+            seen += counts[bucket]
+            if (seen >= rank)
+                return minOf(upperBoundOf(bucket), maxUs)
+        }
+        return maxUs
+    }
+
+    @Synchronized
+    fun percentiles() = Percentiles(count, percentile(0.50), percentile(0.95), percentile(0.99), maxUs)
+
+    @Synchronized
+    fun reset() {
+        counts.fill(0)
+        count = 0
+        maxUs = 0
+    }
+
+    companion object {
+        private const val SUB_BUCKET_BITS = 3
+        private const val SUB_BUCKETS = 1 shl SUB_BUCKET_BITS
+        private const val MAX_EXPONENT = 31
+        private const val MAX_US = (1L shl (MAX_EXPONENT + 1)) - 1
+        private const val BUCKET_COUNT = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS
+
+        // Values below SUB_BUCKETS get a bucket each; above that, the top four
+        // significant bits pick the bucket.
+        private fun bucketOf(us: Long): Int {
+            if (us < SUB_BUCKETS)
+                return us.toInt()
+            val exponent = 63 - java.lang.Long.numberOfLeadingZeros(us)
+            val mantissa = (us ushr (exponent - SUB_BUCKET_BITS)).toInt() and (SUB_BUCKETS - 1)
+            return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + mantissa
+        }
+
+        private fun upperBoundOf(bucket: Int): Long {
+            if (bucket < SUB_BUCKETS)
+                return bucket.toLong()
+            val shift = bucket / SUB_BUCKETS - 1
+            val lower = (SUB_BUCKETS + bucket % SUB_BUCKETS).toLong() shl shift
+            return lower + (1L shl shift) - 1
+        }
+    }
+}
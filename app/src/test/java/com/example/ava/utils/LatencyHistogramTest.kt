@@ -0,0 +1,48 @@
+package com.example.ava.utils
+
+import org.junit.Assert.assertEquals
+import org.junit.Test
+
+class LatencyHistogramTest {
+    // Values below 8 us get a bucket each, so these percentiles are exact.
+    private fun histogramOf(vararg us: Long) = LatencyHistogram().apply {
+        for (value in us)
+            record(value * 1000)
+    }
+
+    @Test
+    fun emptyHistogramReportsZero() {
+        val histogram = LatencyHistogram()
+        assertEquals(0L, histogram.percentile(0.50))
+        assertEquals(0L, histogram.percentile(0.99))
+    }
+
+    @Test
+    fun singleSampleIsEveryPercentile() {
+        val histogram = histogramOf(5)
+        assertEquals(LatencyHistogram.Percentiles(1, 5, 5, 5, 5), histogram.percentiles())
+    }
+
+    @Test
+    fun medianOfThreeIsTheMiddleValue() {
+        val histogram = histogramOf(1, 2, 3)
+        assertEquals(2L, histogram.percentile(0.50))
+        assertEquals(3L, histogram.percentile(0.95))
+        assertEquals(3L, histogram.percentile(0.99))
+    }
+
+    @Test
+    fun p99OfFiftyIsTheMaximum() {
+        val histogram = histogramOf(*LongArray(49) { 1 }, 7)
+        assertEquals(1L, histogram.percentile(0.50))
+        assertEquals(1L, histogram.percentile(0.95))
+        assertEquals(7L, histogram.percentile(0.99))
+    }
+
+    @Test
+    fun fullFractionIsTheMaximum() {
+        val histogram = histogramOf(1, 2, 3, 4)
+        assertEquals(2L, histogram.percentile(0.50))
+        assertEquals(4L, histogram.percentile(1.0))
+    }
+}
@@ -16,6 +16,10 @@ android {
             cmake {
                 cppFlags("")
                 arguments += listOf("-DANDROID_SUPPORT_FLEXIBLE_PAGE_SIZES=ON")
+                // Span tracing of the audio path; see NativeStats.startTrace.
+                if (providers.gradleProperty("microfeatures.tracing").orNull == "true") {
+                    arguments += listOf("-DMICROFEATURES_TRACING=ON")
+                }
             }
         }
     }
@@ -27,6 +31,16 @@ android {
                 getDefaultProguardFile("proguard-android-optimize.txt"),
                 "proguard-rules.pro"
             )
+            externalNativeBuild {
+                cmake {
+                    arguments += listOf("-DMICROFEATURES_OPTIMIZATION=-O3", "-DMICROFEATURES_LTO=ON")
+                    // A device profile from src/main/cpp/host/pgo_build.sh, one
+                    // subdirectory per ABI.
+                    providers.gradleProperty("microfeatures.pgoDir").orNull?.let {
+                        arguments += listOf("-DMICROFEATURES_PGO=USE", "-DMICROFEATURES_PGO_DIR=$it")
+                    }
+                }
+            }
         }
     }
     externalNativeBuild {
@@ -1,141 +1,154 @@
-
-
-
 #include <jni.h>
-#include <iostream>
-#include <vector>
-
-#include "tensorflow/lite/experimental/microfrontend/lib/frontend.h"
-#include "tensorflow/lite/experimental/microfrontend/lib/frontend_util.h"
-
-static const uint8_t FEATURES_STEP_SIZE = 10;
-static const uint8_t PREPROCESSOR_FEATURE_SIZE = 40;
-static const uint8_t FEATURE_DURATION_MS = 30;
-static const uint16_t AUDIO_SAMPLE_FREQUENCY = 16000;
-static const uint16_t SAMPLES_PER_CHUNK =
-        FEATURES_STEP_SIZE * (AUDIO_SAMPLE_FREQUENCY / 1000);
-
-
-static const uint16_t BYTES_PER_CHUNK = SAMPLES_PER_CHUNK * 2;
-
-#define FLOAT32_SCALE 0.0390625f
-
-class MicroFrontend {
-private:
-    FrontendConfig frontend_config;
-    FrontendState frontend_state;
+#include <cstdint>
 
-public:
-    MicroFrontend();
+#include "microfeatures.h"
 
-    FrontendOutput ProcessSamples(int16_t *samples, size_t *num_samples_read);
-};
-
-MicroFrontend::MicroFrontend() {
-    this->frontend_config.window.size_ms = FEATURE_DURATION_MS;
-    this->frontend_config.window.step_size_ms = FEATURES_STEP_SIZE;
-    this->frontend_config.filterbank.num_channels = PREPROCESSOR_FEATURE_SIZE;
-    this->frontend_config.filterbank.lower_band_limit = 125.0;
-    this->frontend_config.filterbank.upper_band_limit = 7500.0;
-    this->frontend_config.noise_reduction.smoothing_bits = 10;
-    this->frontend_config.noise_reduction.even_smoothing = 0.025;
-    this->frontend_config.noise_reduction.odd_smoothing = 0.06;
-    this->frontend_config.noise_reduction.min_signal_remaining = 0.05;
-    this->frontend_config.pcan_gain_control.enable_pcan = 1;
-    this->frontend_config.pcan_gain_control.strength = 0.95;
-    this->frontend_config.pcan_gain_control.offset = 80.0;
-    this->frontend_config.pcan_gain_control.gain_bits = 21;
-    this->frontend_config.log_scale.enable_log = 1;
-    this->frontend_config.log_scale.scale_shift = 6;
-
-    FrontendPopulateState(&(this->frontend_config), &(this->frontend_state),
-                          AUDIO_SAMPLE_FREQUENCY);
+extern "C"
+{
+JNIEXPORT jlong JNICALL
+Java_com_example_microfeatures_MicroFrontend_00024Companion_nativeBytesInUse(
+        JNIEnv *env,
+        jobject thiz
+) {
+    return MicroFrontend_NativeBytesInUse();
 }
 
-FrontendOutput MicroFrontend::ProcessSamples(int16_t *samples, size_t *num_samples_read) {
-
-    return FrontendProcessSamples(&(this->frontend_state), samples,
-                                  SAMPLES_PER_CHUNK, num_samples_read);
-
-    
+JNIEXPORT jint JNICALL
+Java_com_example_microfeatures_MicroFrontend_00024Companion_liveFrontendCount(
+        JNIEnv *env,
+        jobject thiz
+) {
+    return MicroFrontend_LiveCount();
+}
 
-    
-    
-    
+JNIEXPORT jlong JNICALL
+Java_com_example_microfeatures_MicroFrontend_newNativeFrontend(JNIEnv *env, jobject thiz) {
+    return (jlong(MicroFrontend_Create()));
+}
 
-    
-    
-    
-    
+JNIEXPORT void JNICALL
+Java_com_example_microfeatures_MicroFrontend_deleteNativeFrontend(
+        JNIEnv *env,
+        jobject thiz,
+        jlong native_frontend
+) {
+    MicroFrontend_Free((MicroFrontendHandle *) native_frontend);
+}
 
-    
+JNIEXPORT jint JNICALL
+Java_com_example_microfeatures_MicroFrontend_addConsumer(
+        JNIEnv *env,
+        jobject thiz,
+        jlong native_frontend
+) {
+    return MicroFrontend_AddConsumer((MicroFrontendHandle *) native_frontend);
 }
-extern "C"
-{
-static jclass processOutputClass;
-static jmethodID processOutputConstructor;
 
 JNIEXPORT void JNICALL
-Java_com_example_microfeatures_MicroFrontend_00024Companion_initJni(
+Java_com_example_microfeatures_MicroFrontend_removeConsumer(
         JNIEnv *env,
         jobject thiz,
-        jclass jProcessOutputClass
+        jlong native_frontend,
+        jint consumer
 ) {
-    processOutputClass = reinterpret_cast<jclass>(env->NewGlobalRef(jProcessOutputClass));
-    processOutputConstructor = env->GetMethodID(processOutputClass, "<init>", "([FI)V");
+    MicroFrontend_RemoveConsumer((MicroFrontendHandle *) native_frontend, consumer);
 }
 
-JNIEXPORT jlong JNICALL
-Java_com_example_microfeatures_MicroFrontend_newNativeFrontend(JNIEnv *env, jobject thiz) {
-#pragma clang diagnostic push
-#pragma ide diagnostic ignored "MemoryLeak"
-    auto *nativeFrontend = new MicroFrontend();
-#pragma clang diagnostic pop
-    return (jlong(nativeFrontend));
+JNIEXPORT void JNICALL
+Java_com_example_microfeatures_MicroFrontend_resetConsumer(
+        JNIEnv *env,
+        jobject thiz,
+        jlong native_frontend,
+        jint consumer
+) {
+    MicroFrontend_ResetConsumer((MicroFrontendHandle *) native_frontend, consumer);
 }
 
-JNIEXPORT void JNICALL
-Java_com_example_microfeatures_MicroFrontend_deleteNativeFrontend(
+JNIEXPORT jint JNICALL
+Java_com_example_microfeatures_MicroFrontend_addTensorOutput(
         JNIEnv *env,
         jobject thiz,
-        jlong native_frontend
+        jlong native_frontend,
+        jint consumer,
+        jobject tensor,
+        jint data_type,
+        jfloat scale,
+        jint zero_point
 ) {
-    auto *nativeFrontend = (MicroFrontend *) native_frontend;
-    delete nativeFrontend;
+    jlong capacity = env->GetDirectBufferCapacity(tensor);
+    return MicroFrontend_AddTensorOutput((MicroFrontendHandle *) native_frontend, consumer,
+                                         env->GetDirectBufferAddress(tensor),
+                                         capacity > 0 ? (size_t) capacity : 0,
+                                         data_type, scale, zero_point);
 }
 
-JNIEXPORT jobject JNICALL
-Java_com_example_microfeatures_MicroFrontend_processSamples(
+JNIEXPORT jlong JNICALL
+Java_com_example_microfeatures_MicroFrontend_processSamplesToTensors(
         JNIEnv *env,
         jobject thiz,
         jlong native_frontend,
-        jobject audio
+        jobject audio,
+        jint offset,
+        jint length
 ) {
-    auto *nativeFrontend = (MicroFrontend *) native_frontend;
-    auto *samples_ptr = reinterpret_cast<int16_t *>(env->GetDirectBufferAddress(audio));
+    auto *audio_ptr = reinterpret_cast<uint8_t *>(env->GetDirectBufferAddress(audio));
+    if (audio_ptr == nullptr) {
+        return 0;
+    }
+    auto *samples_ptr = reinterpret_cast<const int16_t *>(audio_ptr + offset);
+    uint32_t ready_mask = 0;
+    size_t num_samples_read = MicroFrontend_ProcessToTensors(
+            (MicroFrontendHandle *) native_frontend, samples_ptr,
+            static_cast<size_t>(length) / 2, &ready_mask);
+    return (jlong) (((uint64_t) ready_mask << 32) | (uint32_t) num_samples_read);
+}
 
-    size_t num_samples_read;
-    struct FrontendOutput frontend_output =
-            nativeFrontend->ProcessSamples(samples_ptr, &num_samples_read);
+JNIEXPORT jstring JNICALL
+Java_com_example_microfeatures_MicroFrontend_kernelVariant(
+        JNIEnv *env,
+        jobject thiz,
+        jlong native_frontend
+) {
+    return env->NewStringUTF(
+            MicroFrontend_KernelVariant((MicroFrontendHandle *) native_frontend));
+}
 
-    
-    
-    
-    jfloatArray jFeatures = env->NewFloatArray((int)frontend_output.size);
-    jfloat *jFeaturesPtr = env->GetFloatArrayElements(jFeatures, nullptr);
-    if (jFeaturesPtr != nullptr) {
-        for (std::size_t i = 0; i < frontend_output.size; ++i) {
-            jFeaturesPtr[i] = (float)frontend_output.values[i] * FLOAT32_SCALE;
-        }
-        env->ReleaseFloatArrayElements(jFeatures, jFeaturesPtr, 0);
+JNIEXPORT jbyteArray JNICALL
+Java_com_example_microfeatures_MicroFrontend_saveState(
+        JNIEnv *env,
+        jobject thiz,
+        jlong native_frontend
+) {
+    auto *nativeFrontend = (MicroFrontendHandle *) native_frontend;
+    const size_t size = MicroFrontend_SaveStateSize(nativeFrontend);
+    jbyteArray jState = env->NewByteArray((jsize) size);
+    if (jState == nullptr) {
+        return nullptr;
     }
+    jbyte *jStatePtr = env->GetByteArrayElements(jState, nullptr);
+    if (jStatePtr == nullptr) {
+        return nullptr;
+    }
+    MicroFrontend_SaveState(nativeFrontend, jStatePtr, size);
+    env->ReleaseByteArrayElements(jState, jStatePtr, 0);
+    return jState;
+}
 
-    jobject processOutputObject = env->NewObject(
-            processOutputClass,
-            processOutputConstructor,
-            jFeatures,
-            static_cast<jint>(num_samples_read)
-    );
-    return processOutputObject;
+JNIEXPORT jboolean JNICALL
+Java_com_example_microfeatures_MicroFrontend_restoreState(
+        JNIEnv *env,
+        jobject thiz,
+        jlong native_frontend,
+        jbyteArray state
+) {
+    jbyte *statePtr = env->GetByteArrayElements(state, nullptr);
+    if (statePtr == nullptr) {
+        return JNI_FALSE;
+    }
+    const int restored = MicroFrontend_RestoreState(
+            (MicroFrontendHandle *) native_frontend, statePtr,
+            (size_t) env->GetArrayLength(state));
+    env->ReleaseByteArrayElements(state, statePtr, JNI_ABORT);
+    return restored ? JNI_TRUE : JNI_FALSE;
+}
 }
-}
\ No newline at end of file
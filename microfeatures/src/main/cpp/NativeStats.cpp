@@ -0,0 +1,59 @@
+#include <jni.h>
+#include <cstdint>
+
+#include "microfeatures.h"
+
+extern "C"
+{
+
+// Copies the stage counters into stats as kMicroFeaturesStageCount groups of
+// frames, total ns, max ns and dropped frames.
+JNIEXPORT void JNICALL
+Java_com_example_microfeatures_NativeStats_nativeSnapshot(
+        JNIEnv *env,
+        jobject thiz,
+        jlongArray stats
+) {
+    MicroFeaturesStageStats snapshot[kMicroFeaturesStageCount];
+    MicroFeatures_GetStageStats(snapshot);
+    jlong values[kMicroFeaturesStageCount * 4];
+    for (int stage = 0; stage < kMicroFeaturesStageCount; ++stage) {
+        values[stage * 4] = (jlong) snapshot[stage].frames;
+        values[stage * 4 + 1] = (jlong) snapshot[stage].total_ns;
+        values[stage * 4 + 2] = (jlong) snapshot[stage].max_ns;
+        values[stage * 4 + 3] = (jlong) snapshot[stage].dropped_frames;
+    }
+    env->SetLongArrayRegion(stats, 0, kMicroFeaturesStageCount * 4, values);
+}
+
+JNIEXPORT void JNICALL
+Java_com_example_microfeatures_NativeStats_nativeReset(JNIEnv *env, jobject thiz) {
+    MicroFeatures_ResetStageStats();
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_example_microfeatures_NativeStats_nativeTracingAvailable(JNIEnv *env, jobject thiz) {
+    return MicroFeatures_TracingAvailable() != 0;
+}
+
+JNIEXPORT void JNICALL
+Java_com_example_microfeatures_NativeStats_nativeTraceStart(JNIEnv *env, jobject thiz) {
+    MicroFeatures_TraceStart();
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_example_microfeatures_NativeStats_nativeTraceStopAndWrite(
+        JNIEnv *env,
+        jobject thiz,
+        jstring path
+) {
+    const char *chars = env->GetStringUTFChars(path, nullptr);
+    if (chars == nullptr) {
+        return -1;
+    }
+    const int64_t num_spans = MicroFeatures_TraceStopAndWrite(chars);
+    env->ReleaseStringUTFChars(path, chars);
+    return num_spans;
+}
+
+}
@@ -1,26 +1,26 @@
 #include <jni.h>
-#include "webrtc_ns/noise_suppression.h"
+#include "microfeatures.h"
 
 extern "C" {
 
 JNIEXPORT jlong JNICALL
 Java_com_example_microfeatures_NoiseSuppressor_nativeCreate(JNIEnv *env, jobject thiz) {
-    NsHandle *handle = WebRtcNs_Create();
+    NoiseSuppressorHandle *handle = NoiseSuppressor_Create();
     return reinterpret_cast<jlong>(handle);
 }
 
 JNIEXPORT jint JNICALL
 Java_com_example_microfeatures_NoiseSuppressor_nativeInit(JNIEnv *env, jobject thiz,
                                                           jlong handle, jint sampleRate) {
-    NsHandle *ns = reinterpret_cast<NsHandle *>(handle);
-    return WebRtcNs_Init(ns, static_cast<uint32_t>(sampleRate));
+    NoiseSuppressorHandle *ns = reinterpret_cast<NoiseSuppressorHandle *>(handle);
+    return NoiseSuppressor_Init(ns, static_cast<uint32_t>(sampleRate));
 }
 
 JNIEXPORT jint JNICALL
 Java_com_example_microfeatures_NoiseSuppressor_nativeSetPolicy(JNIEnv *env, jobject thiz,
                                                                jlong handle, jint mode) {
-    NsHandle *ns = reinterpret_cast<NsHandle *>(handle);
-    return WebRtcNs_set_policy(ns, mode);
+    NoiseSuppressorHandle *ns = reinterpret_cast<NoiseSuppressorHandle *>(handle);
+    return NoiseSuppressor_SetPolicy(ns, mode);
 }
 
 JNIEXPORT void JNICALL
@@ -28,33 +28,76 @@ Java_com_example_microfeatures_NoiseSuppressor_nativeProcess(JNIEnv *env, jobjec
                                                              jlong handle,
                                                              jshortArray inputArray,
                                                              jshortArray outputArray) {
-    NsHandle *ns = reinterpret_cast<NsHandle *>(handle);
-    
-    jshort *input = env->GetShortArrayElements(inputArray, nullptr);
-    jshort *output = env->GetShortArrayElements(outputArray, nullptr);
-    
-    const int16_t *inFrame[1] = {input};
-    int16_t *outFrame[1] = {output};
-    
-    WebRtcNs_Analyze(ns, input);
-    WebRtcNs_Process(ns, inFrame, 1, outFrame);
-    
-    env->ReleaseShortArrayElements(inputArray, input, JNI_ABORT);
-    env->ReleaseShortArrayElements(outputArray, output, 0);
+    NoiseSuppressorHandle *ns = reinterpret_cast<NoiseSuppressorHandle *>(handle);
+
+    // Critical access pins the arrays instead of copying them; nothing below
+    // calls back into the JVM.
+    auto *input = static_cast<jshort *>(env->GetPrimitiveArrayCritical(inputArray, nullptr));
+    auto *output = static_cast<jshort *>(env->GetPrimitiveArrayCritical(outputArray, nullptr));
+    if (input != nullptr && output != nullptr) {
+        NoiseSuppressor_Process(ns, input, output);
+    }
+    if (output != nullptr) {
+        env->ReleasePrimitiveArrayCritical(outputArray, output, 0);
+    }
+    if (input != nullptr) {
+        env->ReleasePrimitiveArrayCritical(inputArray, input, JNI_ABORT);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_example_microfeatures_NoiseSuppressor_nativeProcessBuffer(JNIEnv *env, jobject thiz,
+                                                                   jlong handle,
+                                                                   jobject input,
+                                                                   jint inputOffset,
+                                                                   jobject output,
+                                                                   jint outputOffset) {
+    NoiseSuppressorHandle *ns = reinterpret_cast<NoiseSuppressorHandle *>(handle);
+    auto *input_ptr = reinterpret_cast<uint8_t *>(env->GetDirectBufferAddress(input));
+    auto *output_ptr = reinterpret_cast<uint8_t *>(env->GetDirectBufferAddress(output));
+    if (input_ptr == nullptr || output_ptr == nullptr) {
+        return;
+    }
+    NoiseSuppressor_Process(ns, reinterpret_cast<const int16_t *>(input_ptr + inputOffset),
+                            reinterpret_cast<int16_t *>(output_ptr + outputOffset));
+}
+
+JNIEXPORT jint JNICALL
+Java_com_example_microfeatures_NoiseSuppressor_nativeProcessStream(JNIEnv *env, jobject thiz,
+                                                                   jlong handle,
+                                                                   jobject buffer,
+                                                                   jint offset,
+                                                                   jint numSamples) {
+    NoiseSuppressorHandle *ns = reinterpret_cast<NoiseSuppressorHandle *>(handle);
+    auto *buffer_ptr = reinterpret_cast<uint8_t *>(env->GetDirectBufferAddress(buffer));
+    // Leaves the samples as they are, like an uninitialized suppressor.
+    if (buffer_ptr == nullptr) {
+        return numSamples;
+    }
+    return static_cast<jint>(NoiseSuppressor_ProcessStream(
+            ns, reinterpret_cast<int16_t *>(buffer_ptr + offset),
+            static_cast<size_t>(numSamples)));
 }
 
 JNIEXPORT void JNICALL
 Java_com_example_microfeatures_NoiseSuppressor_nativeDestroy(JNIEnv *env, jobject thiz,
                                                              jlong handle) {
-    NsHandle *ns = reinterpret_cast<NsHandle *>(handle);
-    WebRtcNs_Free(ns);
+    NoiseSuppressorHandle *ns = reinterpret_cast<NoiseSuppressorHandle *>(handle);
+    NoiseSuppressor_Free(ns);
 }
 
 JNIEXPORT jfloat JNICALL
 Java_com_example_microfeatures_NoiseSuppressor_nativeGetSpeechProbability(JNIEnv *env, jobject thiz,
                                                                           jlong handle) {
-    NsHandle *ns = reinterpret_cast<NsHandle *>(handle);
-    return WebRtcNs_prior_speech_probability(ns);
+    NoiseSuppressorHandle *ns = reinterpret_cast<NoiseSuppressorHandle *>(handle);
+    return NoiseSuppressor_SpeechProbability(ns);
+}
+
+JNIEXPORT jstring JNICALL
+Java_com_example_microfeatures_NoiseSuppressor_nativeGetKernelVariant(JNIEnv *env, jobject thiz,
+                                                                      jlong handle) {
+    NoiseSuppressorHandle *ns = reinterpret_cast<NoiseSuppressorHandle *>(handle);
+    return env->NewStringUTF(NoiseSuppressor_KernelVariant(ns));
 }
 
 }
@@ -0,0 +1,335 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "microfeatures.h"
+#include "test_signals.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/bits.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_fixed.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_util.h"
+#include "webrtc_ns/noise_suppression.h"
+
+// Times every stage of the wake word frontend in isolation, the frontend end
+// to end and the WebRTC noise suppressor, on ten seconds of each test signal.
+//
+// The pipeline is run once per signal to record the input every stage sees
+// for every frame. Each stage is then timed alone over those inputs, in
+// stream order so stateful stages evolve as they do in the real pipeline.
+// Stages that work in place get their input copied back before every call;
+// the time of the copies alone is measured separately and subtracted. The
+// best of several repetitions is reported.
+
+namespace {
+
+const size_t kNumSamples = 10 * kMicroFrontendSampleRate;
+const size_t kChunkSize = kMicroFrontendSamplesPerChunk;
+const int kNumChannels = kMicroFrontendFeatureSize;
+const int kRepetitions = 15;
+
+volatile uint32_t sink;
+
+double NowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+template<typename Reset, typename Prepare, typename Run>
+double TimeStage(size_t count, Reset reset, Prepare prepare, Run run) {
+    double best = 1e300;
+    for (int repetition = 0; repetition < kRepetitions; ++repetition) {
+        reset();
+        double start = NowNs();
+        for (size_t i = 0; i < count; ++i) {
+            prepare(i);
+        }
+        const double overhead = NowNs() - start;
+        reset();
+        start = NowNs();
+        for (size_t i = 0; i < count; ++i) {
+            prepare(i);
+            run(i);
+        }
+        best = std::min(best, (NowNs() - start - overhead) / count);
+    }
+    return std::max(best, 0.0);
+}
+
+void NoReset() {}
+
+void NoPrepare(size_t) {}
+
+void Report(const char *stage, double ns_per_frame) {
+    printf("  %-36s %9.1f ns/frame %12.0f frames/s\n", stage, ns_per_frame,
+           ns_per_frame > 0.0 ? 1e9 / ns_per_frame : 0.0);
+}
+
+// What every stage of the generic frontend received for each frame.
+struct Recording {
+    size_t num_frames = 0;
+    std::vector<int16_t> window_output;
+    std::vector<int> input_shift;
+    std::vector<struct complex_int16_t> fft_output;
+    std::vector<int32_t> energy;
+    std::vector<uint64_t> work;
+    std::vector<uint32_t> filterbank;
+    std::vector<uint32_t> reduced;
+    std::vector<uint32_t> estimate;
+    std::vector<uint32_t> gained;
+};
+
+Recording Record(struct FrontendState *state, const std::vector<int16_t> &audio) {
+    Recording recording;
+    const size_t window_size = state->window.size;
+    const size_t spectrum_size = state->fft.fft_size / 2 + 1;
+    const int correction_bits =
+            MostSignificantBit32(state->fft.fft_size) - 1 - (kFilterbankBits / 2);
+    FrontendReset(state);
+    for (size_t offset = 0; offset + kChunkSize <= audio.size(); offset += kChunkSize) {
+        size_t num_samples_read;
+        if (!WindowProcessSamples(&state->window, audio.data() + offset, kChunkSize,
+                                  &num_samples_read)) {
+            continue;
+        }
+        recording.num_frames++;
+        recording.window_output.insert(recording.window_output.end(), state->window.output,
+                                       state->window.output + window_size);
+        const int input_shift = 15 - MostSignificantBit32(state->window.max_abs_output_value);
+        recording.input_shift.push_back(input_shift);
+
+        FftCompute(&state->fft, state->window.output, input_shift);
+        recording.fft_output.insert(recording.fft_output.end(), state->fft.output,
+                                    state->fft.output + spectrum_size);
+
+        int32_t *energy = (int32_t *) state->fft.output;
+        FilterbankConvertFftComplexToEnergy(&state->filterbank, state->fft.output, energy);
+        recording.energy.insert(recording.energy.end(), energy, energy + spectrum_size);
+
+        FilterbankAccumulateChannels(&state->filterbank, energy);
+        recording.work.insert(recording.work.end(), state->filterbank.work,
+                              state->filterbank.work + kNumChannels + 1);
+
+        uint32_t *signal = FilterbankSqrt(&state->filterbank, input_shift);
+        recording.filterbank.insert(recording.filterbank.end(), signal, signal + kNumChannels);
+
+        NoiseReductionApply(&state->noise_reduction, signal);
+        recording.reduced.insert(recording.reduced.end(), signal, signal + kNumChannels);
+        recording.estimate.insert(recording.estimate.end(), state->noise_reduction.estimate,
+                                  state->noise_reduction.estimate + kNumChannels);
+
+        PcanGainControlApply(&state->pcan_gain_control, signal);
+        recording.gained.insert(recording.gained.end(), signal, signal + kNumChannels);
+
+        LogScaleApply(&state->log_scale, signal, kNumChannels, correction_bits);
+    }
+    FrontendReset(state);
+    return recording;
+}
+
+void BenchmarkFrontend(const std::vector<int16_t> &audio) {
+    struct FrontendConfig config;
+    MicroFrontend_FillConfig(&config);
+    struct FrontendState state;
+    if (!FrontendPopulateState(&config, &state, kMicroFrontendSampleRate)) {
+        fprintf(stderr, "Failed to populate frontend state\n");
+        return;
+    }
+    const Recording recording = Record(&state, audio);
+    const size_t frames = recording.num_frames;
+    const size_t chunks = audio.size() / kChunkSize;
+    const size_t window_size = state.window.size;
+    const size_t spectrum_size = state.fft.fft_size / 2 + 1;
+    const int correction_bits =
+            MostSignificantBit32(state.fft.fft_size) - 1 - (kFilterbankBits / 2);
+    uint32_t signal[kNumChannels];
+    std::vector<int32_t> energy_buffer(spectrum_size);
+    int32_t *energy = energy_buffer.data();
+    double stages = 0.0;
+    double elapsed;
+
+    // Window input arrives 10 ms at a time; each call completes one frame
+    // once the first window has filled.
+    elapsed = TimeStage(
+            chunks, [&] { WindowReset(&state.window); }, NoPrepare,
+            [&](size_t i) {
+                size_t num_samples_read;
+                sink += WindowProcessSamples(&state.window, audio.data() + i * kChunkSize,
+                                             kChunkSize, &num_samples_read);
+            }) * chunks / frames;
+    Report("WindowProcessSamples", elapsed);
+    stages += elapsed;
+
+    elapsed = TimeStage(frames, NoReset, NoPrepare, [&](size_t i) {
+        FftCompute(&state.fft, &recording.window_output[i * window_size],
+                   recording.input_shift[i]);
+        sink += state.fft.output[i % spectrum_size].real;
+    });
+    Report("FftCompute", elapsed);
+    stages += elapsed;
+
+    elapsed = TimeStage(frames, NoReset, NoPrepare, [&](size_t i) {
+        FilterbankConvertFftComplexToEnergy(
+                &state.filterbank,
+                const_cast<struct complex_int16_t *>(&recording.fft_output[i * spectrum_size]),
+                energy);
+        sink += energy[state.filterbank.start_index];
+    });
+    Report("FilterbankConvertFftComplexToEnergy", elapsed);
+    stages += elapsed;
+
+    elapsed = TimeStage(frames, NoReset, NoPrepare, [&](size_t i) {
+        FilterbankAccumulateChannels(&state.filterbank, &recording.energy[i * spectrum_size]);
+        sink += (uint32_t) state.filterbank.work[1];
+    });
+    Report("FilterbankAccumulateChannels", elapsed);
+    stages += elapsed;
+
+    elapsed = TimeStage(
+            frames, NoReset,
+            [&](size_t i) {
+                memcpy(state.filterbank.work, &recording.work[i * (kNumChannels + 1)],
+                       (kNumChannels + 1) * sizeof(uint64_t));
+            },
+            [&](size_t i) {
+                sink += FilterbankSqrt(&state.filterbank, recording.input_shift[i])[0];
+            });
+    Report("FilterbankSqrt", elapsed);
+    stages += elapsed;
+
+    const double before_post_filterbank = stages;
+    elapsed = TimeStage(
+            frames, [&] { NoiseReductionReset(&state.noise_reduction); },
+            [&](size_t i) {
+                memcpy(signal, &recording.filterbank[i * kNumChannels], sizeof(signal));
+            },
+            [&](size_t) {
+                NoiseReductionApply(&state.noise_reduction, signal);
+                sink += signal[0];
+            });
+    Report("NoiseReductionApply", elapsed);
+    stages += elapsed;
+
+    elapsed = TimeStage(
+            frames, NoReset,
+            [&](size_t i) {
+                memcpy(signal, &recording.reduced[i * kNumChannels], sizeof(signal));
+                memcpy(state.noise_reduction.estimate, &recording.estimate[i * kNumChannels],
+                       sizeof(signal));
+            },
+            [&](size_t) {
+                PcanGainControlApply(&state.pcan_gain_control, signal);
+                sink += signal[0];
+            });
+    Report("PcanGainControlApply", elapsed);
+    stages += elapsed;
+
+    elapsed = TimeStage(
+            frames, NoReset,
+            [&](size_t i) {
+                memcpy(signal, &recording.gained[i * kNumChannels], sizeof(signal));
+            },
+            [&](size_t) {
+                sink += LogScaleApply(&state.log_scale, signal, kNumChannels,
+                                      correction_bits)[0];
+            });
+    Report("LogScaleApply", elapsed);
+    stages += elapsed;
+
+    // What FrontendProcessSamples runs in place of the last three stages.
+    elapsed = TimeStage(
+            frames, [&] { NoiseReductionReset(&state.noise_reduction); },
+            [&](size_t i) {
+                memcpy(signal, &recording.filterbank[i * kNumChannels], sizeof(signal));
+            },
+            [&](size_t) {
+                sink += state.kernels->post_filterbank_apply(
+                        &state.noise_reduction, &state.pcan_gain_control,
+                        &state.log_scale, correction_bits, signal)[0];
+            });
+    Report("PostFilterbankApply (fused)", elapsed);
+    printf("  %-36s %9.1f ns/frame\n", "sum of separate stages", stages);
+    printf("  %-36s %9.1f ns/frame\n", "sum with fused post-filterbank",
+           before_post_filterbank + elapsed);
+
+    elapsed = TimeStage(
+            chunks, [&] { FrontendReset(&state); }, NoPrepare,
+            [&](size_t i) {
+                size_t num_samples_read;
+                struct FrontendOutput output = FrontendProcessSamples(
+                        &state, audio.data() + i * kChunkSize, kChunkSize, &num_samples_read);
+                sink += output.size;
+            }) * chunks / frames;
+    Report("FrontendProcessSamples", elapsed);
+    FrontendFreeStateContents(&state);
+
+    struct FrontendState fixed_state;
+    if (FrontendFixedMatchesConfig(&config, kMicroFrontendSampleRate) &&
+        FrontendFixedPopulateState(&fixed_state)) {
+        elapsed = TimeStage(
+                chunks, [&] { FrontendReset(&fixed_state); }, NoPrepare,
+                [&](size_t i) {
+                    size_t num_samples_read;
+                    struct FrontendOutput output = FrontendFixedProcessSamples(
+                            &fixed_state, audio.data() + i * kChunkSize, kChunkSize,
+                            &num_samples_read);
+                    sink += output.size;
+                }) * chunks / frames;
+        Report("FrontendFixedProcessSamples", elapsed);
+        FrontendFreeStateContents(&fixed_state);
+    }
+}
+
+void BenchmarkNoiseSuppressor(const std::vector<int16_t> &audio) {
+    NsHandle *ns = WebRtcNs_Create();
+    const size_t frame_size = kMicroFrontendSampleRate / 100;
+    const size_t frames = audio.size() / frame_size;
+    std::vector<int16_t> output(frame_size);
+    int16_t *out_frame[1] = {output.data()};
+    auto reset = [&] {
+        WebRtcNs_Init(ns, kMicroFrontendSampleRate);
+        WebRtcNs_set_policy(ns, 2);
+    };
+
+    // Process needs the analysis of the same frame, so it is timed as the
+    // pair minus analysis alone.
+    const double analyze = TimeStage(frames, reset, NoPrepare, [&](size_t i) {
+        WebRtcNs_Analyze(ns, audio.data() + i * frame_size);
+    });
+    const double pair = TimeStage(frames, reset, NoPrepare, [&](size_t i) {
+        const int16_t *in_frame[1] = {audio.data() + i * frame_size};
+        WebRtcNs_Analyze(ns, in_frame[0]);
+        WebRtcNs_Process(ns, in_frame, 1, out_frame);
+        sink += output[0];
+    });
+    // The single-pass path NoiseSuppressor_Process takes, which windows and
+    // transforms each frame once for both halves.
+    const double fused = TimeStage(frames, reset, NoPrepare, [&](size_t i) {
+        WebRtcNs_AnalyzeProcess(ns, audio.data() + i * frame_size, output.data());
+        sink += output[0];
+    });
+    Report("WebRtcNs_Analyze", analyze);
+    Report("WebRtcNs_Process", std::max(pair - analyze, 0.0));
+    Report("WebRtcNs_Analyze + WebRtcNs_Process", pair);
+    Report("WebRtcNs_AnalyzeProcess (fused)", fused);
+    WebRtcNs_Free(ns);
+}
+
+}  // namespace
+
+int main() {
+    printf("kernels: frontend %s, noise suppressor %s\n\n",
+           FrontendKernelsSelect()->name, NsKernelsSelect()->name);
+    for (int signal = 0; signal < kTestSignalCount; ++signal) {
+        const std::vector<int16_t> audio =
+                GenerateTestSignal((TestSignal) signal, kNumSamples, 1 + signal);
+        printf("%s, %zu ms:\n", TestSignalName((TestSignal) signal),
+               kNumSamples * 1000 / kMicroFrontendSampleRate);
+        BenchmarkFrontend(audio);
+        BenchmarkNoiseSuppressor(audio);
+        printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include <stdio.h>
+
+#include <string>
+
+#include "microfeatures.h"
+#include "test_signals.h"
+#include "wav_file.h"
+
+// Writes the synthetic clips in testdata/ that golden_test hashes. The clips
+// are checked in rather than generated by the test because the generator
+// uses libm, whose results may differ between platforms.
+
+namespace {
+
+struct ClipSpec {
+    TestSignal signal;
+    const char *name;
+    size_t milliseconds;
+};
+
+const ClipSpec kClips[] = {
+        {kTestSignalSilence, "silence.wav", 1000},
+        {kTestSignalSpeech, "speech.wav", 3000},
+        {kTestSignalMusic, "music.wav", 2000},
+        {kTestSignalWhiteNoise, "white_noise.wav", 1000},
+};
+
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "%s requires exactly one parameter - the directory to write to\n",
+                argv[0]);
+        return 1;
+    }
+    for (const ClipSpec &clip : kClips) {
+        WavAudio audio;
+        audio.sample_rate = kMicroFrontendSampleRate;
+        audio.num_channels = 1;
+        audio.samples = GenerateTestSignal(
+                clip.signal, clip.milliseconds * kMicroFrontendSampleRate / 1000,
+                1 + clip.signal);
+        const std::string path = std::string(argv[1]) + "/" + clip.name;
+        if (!WriteWav(path.c_str(), audio)) {
+            fprintf(stderr, "Failed to write '%s'\n", path.c_str());
+            return 1;
+        }
+    }
+    return 0;
+}
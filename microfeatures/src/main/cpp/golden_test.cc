@@ -0,0 +1,146 @@
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "microfeatures.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_fixed.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_util.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "wav_file.h"
+
+// Hashes the full 40 channel feature stream of every clip through the
+// generic frontend, the fixed-configuration frontend and the C API, and
+// checks all three against hashes taken from the original unoptimized
+// microfrontend. Both frontends run with every kernel variant the CPU
+// supports. Takes the directory holding this file as its argument.
+//
+// The synthetic clips in testdata/ are written by golden_clip_generator;
+// the other two are the recorded prompt sounds the app ships, downmixed and
+// resampled to 16 kHz. A mismatch prints the new hash, but the table should
+// only change along with the reference behavior.
+
+namespace {
+
+struct GoldenClip {
+    const char *path;
+    size_t num_frames;
+    uint64_t hash;
+};
+
+const GoldenClip kGoldenClips[] = {
+        {"testdata/silence.wav", 98, 0x45c0348e961d6576ull},
+        {"testdata/speech.wav", 298, 0xa346ad172d703abdull},
+        {"testdata/music.wav", 198, 0x389835ae6acc0e88ull},
+        {"testdata/white_noise.wav", 98, 0xd87fa952e3a51f43ull},
+        {"../../../../app/src/main/assets/sounds/continuous_prompt.wav", 48,
+         0x48c6921abc350c50ull},
+        {"../../../../app/src/main/assets/sounds/wake_word_triggered.wav", 163,
+         0xe9bfa2e5dd050203ull},
+};
+
+// FNV-1a over the little-endian bytes of every feature.
+struct FeatureHash {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    size_t num_frames = 0;
+
+    void Add(const uint16_t *values, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ (values[i] & 0xFF)) * 0x100000001b3ull;
+            hash = (hash ^ (values[i] >> 8)) * 0x100000001b3ull;
+        }
+        num_frames++;
+    }
+};
+
+typedef struct FrontendOutput (*ProcessSamplesFunction)(struct FrontendState *, const int16_t *,
+                                                         size_t, size_t *);
+
+FeatureHash HashStages(struct FrontendState *state, ProcessSamplesFunction process,
+                       const std::vector<int16_t> &audio) {
+    FeatureHash result;
+    for (size_t offset = 0; offset + kMicroFrontendSamplesPerChunk <= audio.size();
+         offset += kMicroFrontendSamplesPerChunk) {
+        size_t num_samples_read;
+        struct FrontendOutput output = process(state, audio.data() + offset,
+                                               kMicroFrontendSamplesPerChunk,
+                                               &num_samples_read);
+        if (output.size > 0) {
+            result.Add(output.values, output.size);
+        }
+    }
+    return result;
+}
+
+bool CheckHash(const char *path, const char *path_name, const FeatureHash &actual,
+               const GoldenClip &golden) {
+    if (actual.num_frames == golden.num_frames && actual.hash == golden.hash) {
+        return true;
+    }
+    printf("%s through %s: %zu frames, hash 0x%016llxull\n", path, path_name,
+           actual.num_frames, (unsigned long long) actual.hash);
+    return false;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(GoldenTest_FeatureStreamsMatchReference) {
+    const std::string root = argc > 1 ? std::string(argv[1]) + "/" : std::string();
+    struct FrontendConfig config;
+    MicroFrontend_FillConfig(&config);
+    TF_LITE_MICRO_EXPECT(FrontendFixedMatchesConfig(&config, kMicroFrontendSampleRate));
+
+    for (const GoldenClip &golden : kGoldenClips) {
+        const std::string path = root + golden.path;
+        WavAudio wav;
+        if (!ReadWav(path.c_str(), &wav)) {
+            TF_LITE_MICRO_FAIL(path.c_str());
+            continue;
+        }
+        const std::vector<int16_t> audio = WavToMono(wav, kMicroFrontendSampleRate);
+
+        // Both frontends with every kernel variant the CPU supports.
+        for (int variant = 0; variant < FrontendKernelsCount(); ++variant) {
+            const struct FrontendKernels *kernels = FrontendKernelsVariant(variant);
+            if (!FrontendKernelsSupported(kernels)) {
+                continue;
+            }
+            struct FrontendState state;
+            TF_LITE_MICRO_EXPECT(FrontendPopulateState(&config, &state, kMicroFrontendSampleRate));
+            FrontendSetKernels(&state, kernels);
+            const std::string name = std::string("FrontendProcessSamples/") + kernels->name;
+            TF_LITE_MICRO_EXPECT(CheckHash(golden.path, name.c_str(),
+                                           HashStages(&state, FrontendProcessSamples, audio),
+                                           golden));
+            FrontendFreeStateContents(&state);
+
+            struct FrontendState fixed_state;
+            TF_LITE_MICRO_EXPECT(FrontendFixedPopulateState(&fixed_state));
+            FrontendSetKernels(&fixed_state, kernels);
+            const std::string fixed_name =
+                    std::string("FrontendFixedProcessSamples/") + kernels->name;
+            TF_LITE_MICRO_EXPECT(CheckHash(golden.path, fixed_name.c_str(),
+                                           HashStages(&fixed_state, FrontendFixedProcessSamples,
+                                                      audio),
+                                           golden));
+            FrontendFreeStateContents(&fixed_state);
+        }
+
+        MicroFrontendHandle *frontend = MicroFrontend_Create();
+        const uint16_t *features;
+        size_t num_frames;
+        MicroFrontend_ProcessBatch(frontend, audio.data(), audio.size(), &features, &num_frames);
+        FeatureHash batch;
+        for (size_t i = 0; i < num_frames; ++i) {
+            batch.Add(features + i * kMicroFrontendFeatureSize, kMicroFrontendFeatureSize);
+        }
+        TF_LITE_MICRO_EXPECT(CheckHash(golden.path, "MicroFrontend_ProcessBatch", batch,
+                                       golden));
+        MicroFrontend_Free(frontend);
+    }
+}
+
+TF_LITE_MICRO_TESTS_END
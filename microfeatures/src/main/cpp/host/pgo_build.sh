@@ -0,0 +1,49 @@
+#!/bin/sh
+# Builds the host library three ways and benchmarks the first against the
+# last: a plain release build, an instrumented build whose training run over
+# testdata/ writes the profile, and a link-time optimized build that uses it.
+# The optimized build must still pass the tests, golden hashes included.
+#
+#   microfeatures/src/main/cpp/host/pgo_build.sh [build directory] [-O level]
+#
+# The same options build the Android library. For a device profile, build
+# the armeabi-v7a or arm64-v8a tree with -DMICROFEATURES_PGO=GENERATE, push
+# its pgo_training and testdata/ with adb, run it there with LLVM_PROFILE_FILE
+# pointing at a writable directory, pull the .profraw files into
+# <profile directory>/<abi>/ and merge them with llvm-profdata as below. The
+# release build then takes -Pmicrofeatures.pgoDir=<profile directory>.
+
+set -e
+
+source_dir=$(cd "$(dirname "$0")/.." && pwd)
+build_dir=$(mkdir -p "${1:-build-pgo}" && cd "${1:-build-pgo}" && pwd)
+optimization=${2:--O3}
+profile_dir="$build_dir/profile"
+jobs=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 4)
+
+cmake -S "$source_dir" -B "$build_dir/baseline" -DCMAKE_BUILD_TYPE=Release >/dev/null
+cmake --build "$build_dir/baseline" -j "$jobs"
+
+cmake -S "$source_dir" -B "$build_dir/generate" -DCMAKE_BUILD_TYPE=Release \
+    -DMICROFEATURES_OPTIMIZATION="$optimization" -DMICROFEATURES_PGO=GENERATE \
+    -DMICROFEATURES_PGO_DIR="$profile_dir" >/dev/null
+cmake --build "$build_dir/generate" -j "$jobs" --target pgo_training
+rm -rf "$profile_dir"
+"$build_dir/generate/host/pgo_training" "$source_dir"
+# Clang writes raw profiles that have to be merged; GCC's are used as is.
+if ls "$profile_dir"/*.profraw >/dev/null 2>&1; then
+    llvm-profdata merge -o "$profile_dir/microfeatures.profdata" "$profile_dir"/*.profraw
+fi
+
+cmake -S "$source_dir" -B "$build_dir/optimized" -DCMAKE_BUILD_TYPE=Release \
+    -DMICROFEATURES_OPTIMIZATION="$optimization" -DMICROFEATURES_LTO=ON \
+    -DMICROFEATURES_PGO=USE -DMICROFEATURES_PGO_DIR="$profile_dir" >/dev/null
+cmake --build "$build_dir/optimized" -j "$jobs"
+ctest --test-dir "$build_dir/optimized" --output-on-failure
+
+for benchmark in microfeatures_benchmark frontend_stage_benchmark; do
+    for build in baseline optimized; do
+        echo "== $benchmark, $build"
+        "$build_dir/$build/host/$benchmark"
+    done
+done
@@ -0,0 +1,668 @@
+#include "microfeatures.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <new>
+#include <vector>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_fixed.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_util.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/trace.h"
+#include "webrtc_ns/noise_suppression.h"
+
+static const uint8_t FEATURES_STEP_SIZE = 10;
+static const uint8_t FEATURE_DURATION_MS = 30;
+
+// Native memory held by live frontends, so the app can check it stays flat
+// while detectors are torn down and recreated.
+static std::atomic<int64_t> native_bytes_in_use{0};
+static std::atomic<int32_t> live_frontends{0};
+
+// Per-stage timing read by the diagnostic sensors. Updates are relaxed: the
+// counters are statistics, not synchronization.
+struct StageCounter {
+    std::atomic<uint64_t> frames{0};
+    std::atomic<uint64_t> total_ns{0};
+    std::atomic<uint64_t> max_ns{0};
+    std::atomic<uint64_t> dropped_frames{0};
+
+    void Record(uint64_t ns, uint64_t num_frames) {
+        this->frames.fetch_add(num_frames, std::memory_order_relaxed);
+        this->total_ns.fetch_add(ns, std::memory_order_relaxed);
+        uint64_t max = this->max_ns.load(std::memory_order_relaxed);
+        while (ns > max &&
+               !this->max_ns.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {
+        }
+    }
+
+    void Drop(uint64_t num_frames) {
+        this->dropped_frames.fetch_add(num_frames, std::memory_order_relaxed);
+    }
+};
+
+static StageCounter stage_counters[kMicroFeaturesStageCount];
+
+static uint64_t MonotonicNs() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000u + (uint64_t) now.tv_nsec;
+}
+
+static const size_t MAX_TENSOR_OUTPUTS = 32;  // one bit each in the ready mask
+
+// A model input tensor that frames are quantized into, stride frames at a
+// time, until it is full and ready for inference. Tensors belong to a
+// consumer (e.g. the wake word set or the stop word set) so that one frontend
+// can feed several independent model sets.
+struct TensorOutput {
+    int consumer;
+    void *data;
+    size_t size;
+    size_t filled;
+    int data_type;
+    float scale;
+    int32_t zero_point;
+};
+
+static void WriteTensorFrame(TensorOutput &tensor, const uint16_t *values, size_t num_values) {
+    size_t count = tensor.size - tensor.filled;
+    if (count > num_values) {
+        count = num_values;
+    }
+    if (tensor.data_type == kMicroFrontendTensorFloat32) {
+        float *out = static_cast<float *>(tensor.data) + tensor.filled;
+        for (size_t i = 0; i < count; ++i) {
+            const float value = (float) values[i] * kMicroFrontendFeatureScale;
+            out[i] = tensor.scale != 0.0f ? value / tensor.scale + (float) tensor.zero_point : value;
+        }
+    } else {
+        const int32_t min_value = tensor.data_type == kMicroFrontendTensorInt8 ? -128 : 0;
+        const int32_t max_value = tensor.data_type == kMicroFrontendTensorInt8 ? 127 : 255;
+        uint8_t *out = static_cast<uint8_t *>(tensor.data) + tensor.filled;
+        for (size_t i = 0; i < count; ++i) {
+            const float value = (float) values[i] * kMicroFrontendFeatureScale;
+            int32_t quantized =
+                    (int32_t) floorf(value / tensor.scale + (float) tensor.zero_point + 0.5f);
+            if (quantized < min_value) {
+                quantized = min_value;
+            } else if (quantized > max_value) {
+                quantized = max_value;
+            }
+            out[i] = (uint8_t) quantized;
+        }
+    }
+    tensor.filled += count;
+}
+
+class MicroFrontend {
+private:
+    FrontendConfig frontend_config;
+    FrontendState frontend_state;
+    bool fixed_frontend = false;
+    bool populated = false;
+    size_t reported_bytes = 0;
+
+    std::vector<TensorOutput> tensor_outputs;
+    int next_consumer = 0;
+
+    FrontendOutput ProcessFrame(const int16_t *samples, size_t num_samples,
+                                size_t *num_samples_read) {
+        if (this->fixed_frontend) {
+            return FrontendFixedProcessSamples(&(this->frontend_state), samples, num_samples,
+                                               num_samples_read);
+        }
+        return FrontendProcessSamples(&(this->frontend_state), samples, num_samples,
+                                      num_samples_read);
+    }
+
+    template<typename OnFrame>
+    size_t RunFrames(const int16_t *samples, size_t num_samples, size_t max_frames,
+                     OnFrame on_frame);
+
+public:
+    MicroFrontend();
+
+    ~MicroFrontend();
+
+    bool IsPopulated() const { return this->populated; }
+
+    const char *KernelVariant() const {
+        return this->populated ? this->frontend_state.kernels->name : "";
+    }
+
+    std::vector<uint16_t> batch_features;
+    size_t batch_frames = 0;
+
+    void Reset();
+
+    size_t SaveStateSize() const { return FrontendSaveStateSize(&(this->frontend_state)); }
+
+    size_t SaveState(void *buffer, size_t capacity) const {
+        return FrontendSaveState(&(this->frontend_state), buffer, capacity);
+    }
+
+    bool RestoreState(const void *data, size_t size) {
+        return FrontendRestoreState(&(this->frontend_state), data, size) != 0;
+    }
+
+    FrontendOutput ProcessSamples(const int16_t *samples, size_t num_samples,
+                                  size_t *num_samples_read);
+
+    size_t ProcessBatch(const int16_t *samples, size_t num_samples);
+
+    int AddConsumer();
+
+    void RemoveConsumer(int consumer);
+
+    void ResetConsumer(int consumer);
+
+    int AddTensorOutput(int consumer, void *data, size_t capacity, int data_type, float scale,
+                        int32_t zero_point);
+
+    size_t ProcessToTensors(const int16_t *samples, size_t num_samples, uint32_t *ready_mask);
+};
+
+MicroFrontend::MicroFrontend() {
+    MicroFrontend_FillConfig(&(this->frontend_config));
+
+    // The generated fixed-configuration frontend needs no table setup and
+    // produces the same features; anything else uses the generic one.
+    if (FrontendFixedMatchesConfig(&(this->frontend_config), kMicroFrontendSampleRate)) {
+        this->fixed_frontend = FrontendFixedPopulateState(&(this->frontend_state)) != 0;
+    }
+    if (this->fixed_frontend) {
+        this->populated = true;
+    } else {
+        this->populated = FrontendPopulateState(&(this->frontend_config), &(this->frontend_state),
+                                                kMicroFrontendSampleRate) != 0;
+    }
+    this->batch_features.reserve(kMicroFrontendFeatureSize * 16);
+
+    this->reported_bytes = sizeof(*this) + this->frontend_state.arena_size +
+                           this->batch_features.capacity() * sizeof(uint16_t);
+    native_bytes_in_use += (int64_t) this->reported_bytes;
+    live_frontends++;
+}
+
+MicroFrontend::~MicroFrontend() {
+    if (this->populated) {
+        FrontendFreeStateContents(&(this->frontend_state));
+    }
+    native_bytes_in_use -= (int64_t) this->reported_bytes;
+    live_frontends--;
+}
+
+void MicroFrontend::Reset() {
+    FrontendReset(&(this->frontend_state));
+    for (TensorOutput &tensor : this->tensor_outputs) {
+        tensor.filled = 0;
+    }
+}
+
+FrontendOutput MicroFrontend::ProcessSamples(const int16_t *samples, size_t num_samples,
+                                             size_t *num_samples_read) {
+    return ProcessFrame(samples, num_samples, num_samples_read);
+}
+
+// Runs the frontend over every sample in the buffer, stopping early once
+// max_frames frames have been produced or on_frame returns false. Samples that
+// do not yet complete a window stay in the frontend's window input and are
+// picked up by the next call, so callers never need to re-chunk or compact
+// their buffers.
+template<typename OnFrame>
+size_t MicroFrontend::RunFrames(const int16_t *samples, size_t num_samples, size_t max_frames,
+                                OnFrame on_frame) {
+    size_t consumed = 0;
+    size_t frames = 0;
+    while (consumed < num_samples && frames < max_frames) {
+        size_t num_samples_read = 0;
+        const uint64_t start = MonotonicNs();
+        struct FrontendOutput frontend_output =
+                ProcessFrame(samples + consumed, num_samples - consumed, &num_samples_read);
+        stage_counters[kMicroFeaturesStageFrontend].Record(MonotonicNs() - start,
+                                                           frontend_output.size > 0 ? 1 : 0);
+        consumed += num_samples_read;
+        if (frontend_output.size > 0) {
+            frames++;
+            if (!on_frame(frontend_output)) {
+                break;
+            }
+        }
+        if (num_samples_read == 0) {
+            break;
+        }
+    }
+    return consumed;
+}
+
+size_t MicroFrontend::ProcessBatch(const int16_t *samples, size_t num_samples) {
+    this->batch_features.clear();
+    this->batch_frames = 0;
+    return RunFrames(samples, num_samples, SIZE_MAX, [this](const FrontendOutput &output) {
+        this->batch_features.insert(this->batch_features.end(), output.values,
+                                    output.values + output.size);
+        this->batch_frames++;
+        return true;
+    });
+}
+
+int MicroFrontend::AddConsumer() {
+    return this->next_consumer++;
+}
+
+void MicroFrontend::RemoveConsumer(int consumer) {
+    for (TensorOutput &tensor : this->tensor_outputs) {
+        if (tensor.consumer == consumer) {
+            tensor.data = nullptr;
+        }
+    }
+}
+
+void MicroFrontend::ResetConsumer(int consumer) {
+    for (TensorOutput &tensor : this->tensor_outputs) {
+        if (tensor.consumer == consumer) {
+            tensor.filled = 0;
+        }
+    }
+}
+
+// Returns the tensor id, which is stable until the consumer is removed and
+// is used as the bit index in the ready mask.
+int MicroFrontend::AddTensorOutput(int consumer, void *data, size_t capacity, int data_type,
+                                   float scale, int32_t zero_point) {
+    if (data == nullptr) {
+        return -1;
+    }
+    size_t element_size;
+    if (data_type == kMicroFrontendTensorFloat32) {
+        element_size = sizeof(float);
+    } else if ((data_type == kMicroFrontendTensorUint8 || data_type == kMicroFrontendTensorInt8) && scale > 0.0f) {
+        element_size = sizeof(uint8_t);
+    } else {
+        return -1;
+    }
+    if (capacity < element_size) {
+        return -1;
+    }
+    TensorOutput tensor{consumer, data, capacity / element_size, 0, data_type, scale, zero_point};
+    for (size_t id = 0; id < this->tensor_outputs.size(); ++id) {
+        if (this->tensor_outputs[id].data == nullptr) {
+            this->tensor_outputs[id] = tensor;
+            return (int) id;
+        }
+    }
+    if (this->tensor_outputs.size() >= MAX_TENSOR_OUTPUTS) {
+        return -1;
+    }
+    this->tensor_outputs.push_back(tensor);
+    return (int) this->tensor_outputs.size() - 1;
+}
+
+// Computes each feature frame once and quantizes it into the registered
+// tensors of every consumer, returning as soon as at least one of them is
+// full, so the caller can run inference before the next frame overwrites it.
+// Tensors reported ready by the previous call start filling from the
+// beginning again.
+size_t MicroFrontend::ProcessToTensors(const int16_t *samples, size_t num_samples,
+                                       uint32_t *ready_mask) {
+    for (TensorOutput &tensor : this->tensor_outputs) {
+        if (tensor.filled >= tensor.size) {
+            tensor.filled = 0;
+        }
+    }
+    uint32_t ready = 0;
+    size_t consumed = RunFrames(samples, num_samples, SIZE_MAX,
+                                [this, &ready](const FrontendOutput &output) {
+        const uint64_t start = MonotonicNs();
+        bool written = false;
+        for (size_t id = 0; id < this->tensor_outputs.size(); ++id) {
+            TensorOutput &tensor = this->tensor_outputs[id];
+            if (tensor.data == nullptr) {
+                continue;
+            }
+            WriteTensorFrame(tensor, output.values, output.size);
+            written = true;
+            if (tensor.filled >= tensor.size) {
+                ready |= 1u << id;
+            }
+        }
+        StageCounter &counter = stage_counters[kMicroFeaturesStageTensorWrite];
+        if (written) {
+            counter.Record(MonotonicNs() - start, 1);
+        } else {
+            counter.Drop(1);
+        }
+        return ready == 0;
+    });
+    *ready_mask = ready;
+    return consumed;
+}
+
+static const size_t MAX_NS_FRAME_SIZE = 160;  // 10 ms at 16 kHz, the highest rate WebRtcNs takes
+
+struct NoiseSuppressor {
+    NsHandle *ns = nullptr;
+    uint32_t sample_rate = 0;
+    int policy = 0;
+    bool has_policy = false;
+
+    // NoiseSuppressor_ProcessStream state: input samples short of a full
+    // frame, and denoised samples that did not fit in the caller's buffer.
+    // Together they never hold more than one frame.
+    int16_t pending_input[MAX_NS_FRAME_SIZE];
+    size_t pending_input_size = 0;
+    int16_t pending_output[MAX_NS_FRAME_SIZE];
+    size_t pending_output_size = 0;
+};
+
+static void ProcessNoiseFrame(NoiseSuppressor *suppressor, const int16_t *input,
+                              int16_t *output) {
+    const uint64_t start = MonotonicNs();
+    WebRtcNs_AnalyzeProcess(suppressor->ns, input, output);
+    stage_counters[kMicroFeaturesStageNoiseProcess].Record(MonotonicNs() - start, 1);
+}
+
+extern "C" {
+
+void MicroFrontend_FillConfig(struct FrontendConfig *config) {
+    FrontendFillConfigWithDefaults(config);
+    config->window.size_ms = FEATURE_DURATION_MS;
+    config->window.step_size_ms = FEATURES_STEP_SIZE;
+    config->filterbank.num_channels = kMicroFrontendFeatureSize;
+    config->filterbank.lower_band_limit = 125.0;
+    config->filterbank.upper_band_limit = 7500.0;
+    config->noise_reduction.smoothing_bits = 10;
+    config->noise_reduction.even_smoothing = 0.025;
+    config->noise_reduction.odd_smoothing = 0.06;
+    config->noise_reduction.min_signal_remaining = 0.05;
+    config->pcan_gain_control.enable_pcan = 1;
+    config->pcan_gain_control.strength = 0.95;
+    config->pcan_gain_control.offset = 80.0;
+    config->pcan_gain_control.gain_bits = 21;
+    config->log_scale.enable_log = 1;
+    config->log_scale.scale_shift = 6;
+}
+
+MicroFrontendHandle *MicroFrontend_Create(void) {
+    auto *frontend = new (std::nothrow) MicroFrontend();
+    if (frontend != nullptr && !frontend->IsPopulated()) {
+        delete frontend;
+        frontend = nullptr;
+    }
+    return reinterpret_cast<MicroFrontendHandle *>(frontend);
+}
+
+void MicroFrontend_Free(MicroFrontendHandle *handle) {
+    delete reinterpret_cast<MicroFrontend *>(handle);
+}
+
+void MicroFrontend_Reset(MicroFrontendHandle *handle) {
+    reinterpret_cast<MicroFrontend *>(handle)->Reset();
+}
+
+size_t MicroFrontend_SaveStateSize(const MicroFrontendHandle *handle) {
+    return reinterpret_cast<const MicroFrontend *>(handle)->SaveStateSize();
+}
+
+size_t MicroFrontend_SaveState(const MicroFrontendHandle *handle, void *buffer, size_t capacity) {
+    return reinterpret_cast<const MicroFrontend *>(handle)->SaveState(buffer, capacity);
+}
+
+int MicroFrontend_RestoreState(MicroFrontendHandle *handle, const void *data, size_t size) {
+    return reinterpret_cast<MicroFrontend *>(handle)->RestoreState(data, size) ? 1 : 0;
+}
+
+struct FrontendOutput MicroFrontend_ProcessSamples(MicroFrontendHandle *handle,
+                                                   const int16_t *samples,
+                                                   size_t num_samples,
+                                                   size_t *num_samples_read) {
+    return reinterpret_cast<MicroFrontend *>(handle)->ProcessSamples(samples, num_samples,
+                                                                     num_samples_read);
+}
+
+size_t MicroFrontend_ProcessBatch(MicroFrontendHandle *handle, const int16_t *samples,
+                                  size_t num_samples, const uint16_t **features,
+                                  size_t *num_frames) {
+    auto *frontend = reinterpret_cast<MicroFrontend *>(handle);
+    size_t num_samples_read = frontend->ProcessBatch(samples, num_samples);
+    *features = frontend->batch_features.data();
+    *num_frames = frontend->batch_frames;
+    return num_samples_read;
+}
+
+int MicroFrontend_AddConsumer(MicroFrontendHandle *handle) {
+    return reinterpret_cast<MicroFrontend *>(handle)->AddConsumer();
+}
+
+void MicroFrontend_RemoveConsumer(MicroFrontendHandle *handle, int consumer) {
+    reinterpret_cast<MicroFrontend *>(handle)->RemoveConsumer(consumer);
+}
+
+void MicroFrontend_ResetConsumer(MicroFrontendHandle *handle, int consumer) {
+    reinterpret_cast<MicroFrontend *>(handle)->ResetConsumer(consumer);
+}
+
+int MicroFrontend_AddTensorOutput(MicroFrontendHandle *handle, int consumer, void *data,
+                                  size_t capacity, int data_type, float scale,
+                                  int32_t zero_point) {
+    return reinterpret_cast<MicroFrontend *>(handle)->AddTensorOutput(
+            consumer, data, capacity, data_type, scale, zero_point);
+}
+
+size_t MicroFrontend_ProcessToTensors(MicroFrontendHandle *handle, const int16_t *samples,
+                                      size_t num_samples, uint32_t *ready_mask) {
+    return reinterpret_cast<MicroFrontend *>(handle)->ProcessToTensors(samples, num_samples,
+                                                                       ready_mask);
+}
+
+int64_t MicroFrontend_NativeBytesInUse(void) {
+    return native_bytes_in_use.load();
+}
+
+int32_t MicroFrontend_LiveCount(void) {
+    return live_frontends.load();
+}
+
+void MicroFeatures_GetStageStats(struct MicroFeaturesStageStats *stats) {
+    for (int stage = 0; stage < kMicroFeaturesStageCount; ++stage) {
+        const StageCounter &counter = stage_counters[stage];
+        stats[stage].frames = counter.frames.load(std::memory_order_relaxed);
+        stats[stage].total_ns = counter.total_ns.load(std::memory_order_relaxed);
+        stats[stage].max_ns = counter.max_ns.load(std::memory_order_relaxed);
+        stats[stage].dropped_frames = counter.dropped_frames.load(std::memory_order_relaxed);
+    }
+}
+
+void MicroFeatures_ResetStageStats(void) {
+    for (StageCounter &counter : stage_counters) {
+        counter.frames.store(0, std::memory_order_relaxed);
+        counter.total_ns.store(0, std::memory_order_relaxed);
+        counter.max_ns.store(0, std::memory_order_relaxed);
+        counter.dropped_frames.store(0, std::memory_order_relaxed);
+    }
+}
+
+int MicroFeatures_TracingAvailable(void) {
+#ifdef MICROFEATURES_TRACING
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+void MicroFeatures_TraceStart(void) {
+    TraceStart();
+}
+
+int64_t MicroFeatures_TraceStopAndWrite(const char *path) {
+    TraceStop();
+    FILE *file = fopen(path, "w");
+    if (file == nullptr) {
+        return -1;
+    }
+    const size_t num_spans = TraceWriteJson(file);
+    return fclose(file) == 0 ? (int64_t) num_spans : -1;
+}
+
+const char *MicroFrontend_KernelVariant(const MicroFrontendHandle *handle) {
+    return reinterpret_cast<const MicroFrontend *>(handle)->KernelVariant();
+}
+
+NoiseSuppressorHandle *NoiseSuppressor_Create(void) {
+    auto *suppressor = new (std::nothrow) NoiseSuppressor();
+    if (suppressor == nullptr) {
+        return nullptr;
+    }
+    suppressor->ns = WebRtcNs_Create();
+    if (suppressor->ns == nullptr) {
+        delete suppressor;
+        return nullptr;
+    }
+    return reinterpret_cast<NoiseSuppressorHandle *>(suppressor);
+}
+
+void NoiseSuppressor_Free(NoiseSuppressorHandle *handle) {
+    auto *suppressor = reinterpret_cast<NoiseSuppressor *>(handle);
+    if (suppressor != nullptr) {
+        WebRtcNs_Free(suppressor->ns);
+        delete suppressor;
+    }
+}
+
+int NoiseSuppressor_Init(NoiseSuppressorHandle *handle, uint32_t sample_rate) {
+    auto *suppressor = reinterpret_cast<NoiseSuppressor *>(handle);
+    if (WebRtcNs_Init(suppressor->ns, sample_rate) != 0) {
+        return -1;
+    }
+    suppressor->sample_rate = sample_rate;
+    suppressor->has_policy = false;
+    suppressor->pending_input_size = 0;
+    suppressor->pending_output_size = 0;
+    return 0;
+}
+
+int NoiseSuppressor_SetPolicy(NoiseSuppressorHandle *handle, int mode) {
+    auto *suppressor = reinterpret_cast<NoiseSuppressor *>(handle);
+    if (WebRtcNs_set_policy(suppressor->ns, mode) != 0) {
+        return -1;
+    }
+    suppressor->policy = mode;
+    suppressor->has_policy = true;
+    return 0;
+}
+
+int NoiseSuppressor_Reset(NoiseSuppressorHandle *handle) {
+    auto *suppressor = reinterpret_cast<NoiseSuppressor *>(handle);
+    if (suppressor->sample_rate == 0 ||
+        WebRtcNs_Init(suppressor->ns, suppressor->sample_rate) != 0) {
+        return -1;
+    }
+    suppressor->pending_input_size = 0;
+    suppressor->pending_output_size = 0;
+    if (suppressor->has_policy) {
+        return WebRtcNs_set_policy(suppressor->ns, suppressor->policy);
+    }
+    return 0;
+}
+
+size_t NoiseSuppressor_FrameSize(const NoiseSuppressorHandle *handle) {
+    return reinterpret_cast<const NoiseSuppressor *>(handle)->sample_rate / 100;
+}
+
+void NoiseSuppressor_Process(NoiseSuppressorHandle *handle, const int16_t *input,
+                             int16_t *output) {
+    auto *suppressor = reinterpret_cast<NoiseSuppressor *>(handle);
+    if (suppressor->sample_rate == 0) {
+        stage_counters[kMicroFeaturesStageNoiseProcess].Drop(1);
+        return;
+    }
+    ProcessNoiseFrame(suppressor, input, output);
+}
+
+// The denoised stream is the concatenation of pending_output, the frame
+// completed from pending_input (head) and the frames processed in place in
+// samples (body). It is written to the front of samples; whatever does not
+// fit is kept in pending_output for the next call.
+size_t NoiseSuppressor_ProcessStream(NoiseSuppressorHandle *handle, int16_t *samples,
+                                     size_t num_samples) {
+    auto *suppressor = reinterpret_cast<NoiseSuppressor *>(handle);
+    const size_t frame_size = suppressor->sample_rate / 100;
+    if (frame_size == 0) {
+        stage_counters[kMicroFeaturesStageNoiseProcess].Drop(num_samples / MAX_NS_FRAME_SIZE);
+        return 0;
+    }
+
+    size_t head_size = 0;
+    size_t body_start = 0;
+    if (suppressor->pending_input_size > 0) {
+        const size_t needed = frame_size - suppressor->pending_input_size;
+        const size_t taken = std::min(needed, num_samples);
+        std::memcpy(suppressor->pending_input + suppressor->pending_input_size, samples,
+                    taken * sizeof(int16_t));
+        suppressor->pending_input_size += taken;
+        body_start = taken;
+        if (taken == needed) {
+            ProcessNoiseFrame(suppressor, suppressor->pending_input, suppressor->pending_input);
+            head_size = frame_size;
+        }
+    }
+    const size_t body_size = (num_samples - body_start) / frame_size * frame_size;
+    for (size_t offset = body_start; offset < body_start + body_size; offset += frame_size) {
+        ProcessNoiseFrame(suppressor, samples + offset, samples + offset);
+    }
+
+    const size_t carry_size = suppressor->pending_output_size;
+    const size_t total = carry_size + head_size + body_size;
+    const size_t written = std::min(total, num_samples);
+
+    // Everything past num_samples becomes the next pending output.
+    int16_t overflow[MAX_NS_FRAME_SIZE];
+    for (size_t i = written; i < total; ++i) {
+        if (i < carry_size) {
+            overflow[i - written] = suppressor->pending_output[i];
+        } else if (i < carry_size + head_size) {
+            overflow[i - written] = suppressor->pending_input[i - carry_size];
+        } else {
+            overflow[i - written] = samples[body_start + i - carry_size - head_size];
+        }
+    }
+    int16_t tail[MAX_NS_FRAME_SIZE];
+    const size_t tail_size = num_samples - body_start - body_size;
+    std::memcpy(tail, samples + body_start + body_size, tail_size * sizeof(int16_t));
+
+    // The body only moves towards the end of the buffer: a head frame is
+    // always longer than the input it consumed.
+    if (carry_size + head_size < written) {
+        std::memmove(samples + carry_size + head_size, samples + body_start,
+                     (written - carry_size - head_size) * sizeof(int16_t));
+    }
+    if (carry_size < written) {
+        std::memcpy(samples + carry_size, suppressor->pending_input,
+                    std::min(head_size, written - carry_size) * sizeof(int16_t));
+    }
+    std::memcpy(samples, suppressor->pending_output,
+                std::min(carry_size, written) * sizeof(int16_t));
+
+    std::memcpy(suppressor->pending_output, overflow, (total - written) * sizeof(int16_t));
+    suppressor->pending_output_size = total - written;
+    if (head_size > 0 || suppressor->pending_input_size == 0) {
+        std::memcpy(suppressor->pending_input, tail, tail_size * sizeof(int16_t));
+        suppressor->pending_input_size = tail_size;
+    }
+    return written;
+}
+
+float NoiseSuppressor_SpeechProbability(NoiseSuppressorHandle *handle) {
+    return WebRtcNs_prior_speech_probability(reinterpret_cast<NoiseSuppressor *>(handle)->ns);
+}
+
+const char *NoiseSuppressor_KernelVariant(const NoiseSuppressorHandle *handle) {
+    return WebRtcNs_kernels(reinterpret_cast<const NoiseSuppressor *>(handle)->ns)->name;
+}
+
+}
@@ -0,0 +1,180 @@
+#ifndef MICROFEATURES_MICROFEATURES_H_
+#define MICROFEATURES_MICROFEATURES_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend.h"
+
+// Plain C interface to the wake word feature frontend and the noise
+// suppressor. The JNI bindings in MicroFrontend.cpp and NoiseSuppressor.cpp
+// are thin wrappers over it, and host builds link it directly for tests and
+// benchmarks.
+
+#define kMicroFrontendFeatureSize 40
+#define kMicroFrontendSampleRate 16000
+#define kMicroFrontendSamplesPerChunk 160
+
+// Multiplier from the frontend's uint16 features to the float model input.
+#define kMicroFrontendFeatureScale 0.0390625f
+
+#define kMicroFrontendTensorFloat32 0
+#define kMicroFrontendTensorUint8 1
+#define kMicroFrontendTensorInt8 2
+
+// Stages timed by the process-wide counters below. Frontend is the feature
+// computation, tensor write the quantization into model inputs and noise
+// process the fused analysis and suppression pass of the noise suppressor.
+#define kMicroFeaturesStageFrontend 0
+#define kMicroFeaturesStageTensorWrite 1
+#define kMicroFeaturesStageNoiseProcess 2
+#define kMicroFeaturesStageCount 3
+
+// Counters for one stage, summed over every frontend and suppressor in the
+// process. dropped_frames counts frames the stage produced or was handed but
+// had nowhere to put: feature frames with no tensor registered, or
+// suppressor frames passed before NoiseSuppressor_Init.
+struct MicroFeaturesStageStats {
+    uint64_t frames;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t dropped_frames;
+};
+
+struct FrontendConfig;
+
+typedef struct MicroFrontendT MicroFrontendHandle;
+typedef struct NoiseSuppressorT NoiseSuppressorHandle;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fills config with the wake word feature settings every frontend created
+// here uses, for callers that drive the microfrontend stages directly.
+void MicroFrontend_FillConfig(struct FrontendConfig *config);
+
+// Creates a frontend for 16 kHz audio producing kMicroFrontendFeatureSize
+// features every 10 ms. Returns NULL if the state cannot be allocated.
+MicroFrontendHandle *MicroFrontend_Create(void);
+
+void MicroFrontend_Free(MicroFrontendHandle *handle);
+
+// Clears the window, noise estimate and tensor fill levels so the next call
+// starts a new stream. Registered buffers and consumers are kept.
+void MicroFrontend_Reset(MicroFrontendHandle *handle);
+
+// Size of the blob MicroFrontend_SaveState writes, at most a few kilobytes.
+size_t MicroFrontend_SaveStateSize(const MicroFrontendHandle *handle);
+
+// Copies the noise estimate and the pending window samples into buffer so a
+// later frontend can pick up without re-adapting to the room. Returns the
+// number of bytes written, or 0 if capacity is too small.
+size_t MicroFrontend_SaveState(const MicroFrontendHandle *handle, void *buffer, size_t capacity);
+
+// Loads a blob from MicroFrontend_SaveState. Returns 0 and leaves the
+// frontend untouched if the blob does not match its configuration.
+int MicroFrontend_RestoreState(MicroFrontendHandle *handle, const void *data, size_t size);
+
+// Runs the frontend until it produces one frame or runs out of samples. The
+// returned values stay valid until the next call on the same handle.
+struct FrontendOutput MicroFrontend_ProcessSamples(MicroFrontendHandle *handle,
+                                                   const int16_t *samples,
+                                                   size_t num_samples,
+                                                   size_t *num_samples_read);
+
+// Computes every frame in the buffer. On return *features points to
+// *num_frames * kMicroFrontendFeatureSize values owned by the handle. Returns
+// the number of samples consumed.
+size_t MicroFrontend_ProcessBatch(MicroFrontendHandle *handle, const int16_t *samples,
+                                  size_t num_samples, const uint16_t **features,
+                                  size_t *num_frames);
+
+int MicroFrontend_AddConsumer(MicroFrontendHandle *handle);
+
+void MicroFrontend_RemoveConsumer(MicroFrontendHandle *handle, int consumer);
+
+void MicroFrontend_ResetConsumer(MicroFrontendHandle *handle, int consumer);
+
+// Returns the tensor id, the bit reported in the ProcessToTensors ready mask,
+// or -1 if the tensor cannot be registered.
+int MicroFrontend_AddTensorOutput(MicroFrontendHandle *handle, int consumer, void *data,
+                                  size_t capacity, int data_type, float scale,
+                                  int32_t zero_point);
+
+// Returns the number of samples consumed; *ready_mask has a bit set for each
+// tensor that became full.
+size_t MicroFrontend_ProcessToTensors(MicroFrontendHandle *handle, const int16_t *samples,
+                                      size_t num_samples, uint32_t *ready_mask);
+
+int64_t MicroFrontend_NativeBytesInUse(void);
+
+int32_t MicroFrontend_LiveCount(void);
+
+// Fills stats[0..kMicroFeaturesStageCount) with the counters since the last
+// reset. Cheap enough to poll; entries are read without a lock, so a snapshot
+// taken mid-frame may be one frame out between fields.
+void MicroFeatures_GetStageStats(struct MicroFeaturesStageStats *stats);
+
+void MicroFeatures_ResetStageStats(void);
+
+// Whether this library was built with MICROFEATURES_TRACING. Without it the
+// trace functions below record nothing.
+int MicroFeatures_TracingAvailable(void);
+
+// Starts recording spans of the frontend and noise suppressor stages,
+// dropping those of any earlier trace.
+void MicroFeatures_TraceStart(void);
+
+// Stops recording and writes the spans to path as Chrome trace JSON, for
+// Perfetto or chrome://tracing. Returns the number of spans written or -1 if
+// the file cannot be created.
+int64_t MicroFeatures_TraceStopAndWrite(const char *path);
+
+// Name of the kernel variant picked for this CPU: "scalar", "neon" or
+// "sse4.1". Empty if the frontend failed to populate.
+const char *MicroFrontend_KernelVariant(const MicroFrontendHandle *handle);
+
+// Creates an uninitialized noise suppressor; call NoiseSuppressor_Init before
+// processing.
+NoiseSuppressorHandle *NoiseSuppressor_Create(void);
+
+void NoiseSuppressor_Free(NoiseSuppressorHandle *handle);
+
+// Returns 0 on success or -1 for an unsupported sample rate.
+int NoiseSuppressor_Init(NoiseSuppressorHandle *handle, uint32_t sample_rate);
+
+// mode is 0 (mild), 1 (medium) or 2 (aggressive). Returns 0 or -1.
+int NoiseSuppressor_SetPolicy(NoiseSuppressorHandle *handle, int mode);
+
+// Restores the state right after the last Init and SetPolicy.
+int NoiseSuppressor_Reset(NoiseSuppressorHandle *handle);
+
+// Number of samples in the 10 ms frames NoiseSuppressor_Process takes.
+size_t NoiseSuppressor_FrameSize(const NoiseSuppressorHandle *handle);
+
+// Analyzes and suppresses one 10 ms frame. input and output may alias. Before
+// NoiseSuppressor_Init the frame is dropped and output left untouched.
+void NoiseSuppressor_Process(NoiseSuppressorHandle *handle, const int16_t *input,
+                             int16_t *output);
+
+// Denoises any number of samples in place, one native call per audio read.
+// Samples short of a full frame are held until the next call, so the output
+// trails the input by less than a frame and no sample is lost or repeated.
+// Returns how many denoised samples were written to the start of samples,
+// which equals num_samples whenever every call is a multiple of the frame
+// size. Reset and Init drop the held samples; do not interleave with
+// NoiseSuppressor_Process on the same handle.
+size_t NoiseSuppressor_ProcessStream(NoiseSuppressorHandle *handle, int16_t *samples,
+                                     size_t num_samples);
+
+float NoiseSuppressor_SpeechProbability(NoiseSuppressorHandle *handle);
+
+// Name of the kernel variant picked for this CPU, as for MicroFrontend.
+const char *NoiseSuppressor_KernelVariant(const NoiseSuppressorHandle *handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MICROFEATURES_MICROFEATURES_H_
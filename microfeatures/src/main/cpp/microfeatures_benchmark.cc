@@ -0,0 +1,83 @@
+#include <stdio.h>
+#include <time.h>
+
+#include <cmath>
+#include <vector>
+
+#include "microfeatures.h"
+
+// Times the frontend and the noise suppressor through the C API on ten
+// seconds of synthetic 16 kHz audio, reporting the cost per 10 ms of audio.
+
+namespace {
+
+const size_t kNumSamples = 10 * kMicroFrontendSampleRate;
+const int kRepetitions = 20;
+
+double NowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+}
+
+int main() {
+    std::vector<int16_t> audio(kNumSamples);
+    uint32_t seed = 1;
+    for (size_t i = 0; i < kNumSamples; ++i) {
+        seed = seed * 1103515245 + 12345;
+        const float noise = (float) ((int32_t) (seed >> 16) - 32768) / 16.0f;
+        const float tone = 6000.0f * sinf(2.0f * 3.14159265f * 440.0f * i /
+                                          kMicroFrontendSampleRate);
+        audio[i] = (int16_t) (noise + ((i / 8000) % 2 ? tone : 0.0f));
+    }
+    const size_t num_chunks = kNumSamples / kMicroFrontendSamplesPerChunk;
+
+    MicroFrontendHandle *frontend = MicroFrontend_Create();
+    NoiseSuppressorHandle *suppressor = NoiseSuppressor_Create();
+    if (frontend == nullptr || suppressor == nullptr ||
+        NoiseSuppressor_Init(suppressor, kMicroFrontendSampleRate) != 0 ||
+        NoiseSuppressor_SetPolicy(suppressor, 2) != 0) {
+        fprintf(stderr, "Failed to create the frontend or noise suppressor\n");
+        return 1;
+    }
+
+    uint64_t checksum = 0;
+    double start = NowNs();
+    for (int repetition = 0; repetition < kRepetitions; ++repetition) {
+        MicroFrontend_Reset(frontend);
+        for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+            size_t num_samples_read;
+            struct FrontendOutput output = MicroFrontend_ProcessSamples(
+                    frontend, audio.data() + chunk * kMicroFrontendSamplesPerChunk,
+                    kMicroFrontendSamplesPerChunk, &num_samples_read);
+            for (size_t i = 0; i < output.size; ++i) {
+                checksum += output.values[i];
+            }
+        }
+    }
+    const double frontend_ns = (NowNs() - start) / (kRepetitions * num_chunks);
+
+    const size_t frame_size = NoiseSuppressor_FrameSize(suppressor);
+    std::vector<int16_t> output(frame_size);
+    start = NowNs();
+    for (int repetition = 0; repetition < kRepetitions; ++repetition) {
+        NoiseSuppressor_Reset(suppressor);
+        for (size_t offset = 0; offset + frame_size <= kNumSamples; offset += frame_size) {
+            NoiseSuppressor_Process(suppressor, audio.data() + offset, output.data());
+            checksum += (uint16_t) output[0];
+        }
+    }
+    const double suppressor_ns = (NowNs() - start) / (kRepetitions * (kNumSamples / frame_size));
+
+    printf("frontend:         %8.1f ns per 10 ms (%.0fx real time)\n", frontend_ns,
+           1e7 / frontend_ns);
+    printf("noise suppressor: %8.1f ns per 10 ms (%.0fx real time)\n", suppressor_ns,
+           1e7 / suppressor_ns);
+    printf("checksum: %llu\n", (unsigned long long) checksum);
+
+    NoiseSuppressor_Free(suppressor);
+    MicroFrontend_Free(frontend);
+    return 0;
+}
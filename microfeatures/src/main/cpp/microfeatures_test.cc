@@ -0,0 +1,481 @@
+#include "microfeatures.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "webrtc_ns/fft4g.h"
+#include "webrtc_ns/noise_suppression.h"
+
+namespace {
+
+const size_t kNumSamples = kMicroFrontendSampleRate;
+const size_t kWindowSamples = 480;
+
+// A 440 Hz tone that fades in over background noise, so the noise estimate
+// and gain control both move during the clip.
+std::vector<int16_t> MakeAudio(uint32_t seed) {
+    std::vector<int16_t> audio(kNumSamples);
+    for (size_t i = 0; i < kNumSamples; ++i) {
+        seed = seed * 1103515245 + 12345;
+        const float noise = (float) ((int32_t) (seed >> 16) - 32768) / 16.0f;
+        const float tone = 8000.0f * (float) i / kNumSamples *
+                           sinf(2.0f * 3.14159265f * 440.0f * i / kMicroFrontendSampleRate);
+        audio[i] = (int16_t) (noise + tone);
+    }
+    return audio;
+}
+
+std::vector<uint16_t> RunChunks(MicroFrontendHandle *frontend,
+                                const std::vector<int16_t> &audio) {
+    std::vector<uint16_t> features;
+    for (size_t offset = 0; offset + kMicroFrontendSamplesPerChunk <= audio.size();
+         offset += kMicroFrontendSamplesPerChunk) {
+        size_t num_samples_read = 0;
+        struct FrontendOutput output = MicroFrontend_ProcessSamples(
+                frontend, audio.data() + offset, kMicroFrontendSamplesPerChunk,
+                &num_samples_read);
+        features.insert(features.end(), output.values, output.values + output.size);
+    }
+    return features;
+}
+
+std::vector<int16_t> RunSuppressor(NoiseSuppressorHandle *suppressor,
+                                   const std::vector<int16_t> &audio) {
+    const size_t frame_size = NoiseSuppressor_FrameSize(suppressor);
+    std::vector<int16_t> output(audio.size());
+    for (size_t offset = 0; offset + frame_size <= audio.size(); offset += frame_size) {
+        NoiseSuppressor_Process(suppressor, audio.data() + offset, output.data() + offset);
+    }
+    return output;
+}
+
+void LibmLog1p(const float *in, float *out, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        out[i] = log1pf(in[i]);
+    }
+}
+
+void LibmExp(const float *in, float scale, float *out, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        out[i] = expf(scale * in[i]);
+    }
+}
+
+// Runs audio through a bare WebRtcNs instance with the given kernels.
+std::vector<int16_t> RunNsKernels(const NsKernels *kernels, const std::vector<int16_t> &audio) {
+    NsHandle *ns = WebRtcNs_Create();
+    WebRtcNs_Init(ns, kMicroFrontendSampleRate);
+    WebRtcNs_set_policy(ns, 2);
+    WebRtcNs_set_kernels(ns, kernels);
+    const size_t frame_size = kMicroFrontendSampleRate / 100;
+    std::vector<int16_t> output(audio.size());
+    for (size_t offset = 0; offset + frame_size <= audio.size(); offset += frame_size) {
+        const int16_t *in_frame[1] = {audio.data() + offset};
+        int16_t *out_frame[1] = {output.data() + offset};
+        WebRtcNs_Analyze(ns, in_frame[0]);
+        WebRtcNs_Process(ns, in_frame, 1, out_frame);
+    }
+    WebRtcNs_Free(ns);
+    return output;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(MicroFrontendTest_ProcessSamplesProducesFrames) {
+    const int32_t live_frontends = MicroFrontend_LiveCount();
+    const int64_t bytes_in_use = MicroFrontend_NativeBytesInUse();
+    MicroFrontendHandle *frontend = MicroFrontend_Create();
+    TF_LITE_MICRO_EXPECT(frontend != nullptr);
+    TF_LITE_MICRO_EXPECT_EQ(MicroFrontend_LiveCount(), live_frontends + 1);
+    TF_LITE_MICRO_EXPECT_GT(MicroFrontend_NativeBytesInUse(), bytes_in_use);
+
+    const std::vector<uint16_t> features = RunChunks(frontend, MakeAudio(1));
+    const size_t expected_frames =
+            (kNumSamples - kWindowSamples) / kMicroFrontendSamplesPerChunk + 1;
+    TF_LITE_MICRO_EXPECT_EQ(features.size(), expected_frames * kMicroFrontendFeatureSize);
+
+    MicroFrontend_Free(frontend);
+    TF_LITE_MICRO_EXPECT_EQ(MicroFrontend_LiveCount(), live_frontends);
+    TF_LITE_MICRO_EXPECT_EQ(MicroFrontend_NativeBytesInUse(), bytes_in_use);
+}
+
+TF_LITE_MICRO_TEST(MicroFrontendTest_ResetRestartsStream) {
+    MicroFrontendHandle *frontend = MicroFrontend_Create();
+    const std::vector<int16_t> audio = MakeAudio(2);
+    const std::vector<uint16_t> first = RunChunks(frontend, audio);
+    MicroFrontend_Reset(frontend);
+    const std::vector<uint16_t> second = RunChunks(frontend, audio);
+    TF_LITE_MICRO_EXPECT(!first.empty());
+    TF_LITE_MICRO_EXPECT(first == second);
+    MicroFrontend_Free(frontend);
+}
+
+TF_LITE_MICRO_TEST(MicroFrontendTest_RestoredStateContinuesStream) {
+    const std::vector<int16_t> audio = MakeAudio(7);
+    // Splits mid-window so the snapshot carries pending samples too.
+    const size_t split = kNumSamples / 2 + 37;
+    const size_t rest = kNumSamples - split;
+
+    MicroFrontendHandle *original = MicroFrontend_Create();
+    const uint16_t *features = nullptr;
+    size_t num_frames = 0;
+    MicroFrontend_ProcessBatch(original, audio.data(), split, &features, &num_frames);
+    std::vector<uint8_t> blob(MicroFrontend_SaveStateSize(original));
+    TF_LITE_MICRO_EXPECT_EQ(MicroFrontend_SaveState(original, blob.data(), blob.size() - 1), 0u);
+    TF_LITE_MICRO_EXPECT_EQ(MicroFrontend_SaveState(original, blob.data(), blob.size()),
+                            blob.size());
+    MicroFrontend_ProcessBatch(original, audio.data() + split, rest, &features, &num_frames);
+    const std::vector<uint16_t> expected(features, features + num_frames * kMicroFrontendFeatureSize);
+    MicroFrontend_Free(original);
+
+    MicroFrontendHandle *restored = MicroFrontend_Create();
+    TF_LITE_MICRO_EXPECT(!MicroFrontend_RestoreState(restored, blob.data(), blob.size() - 1));
+    std::vector<uint8_t> corrupt = blob;
+    corrupt[0] ^= 0xFF;
+    TF_LITE_MICRO_EXPECT(!MicroFrontend_RestoreState(restored, corrupt.data(), corrupt.size()));
+    TF_LITE_MICRO_EXPECT(MicroFrontend_RestoreState(restored, blob.data(), blob.size()));
+    MicroFrontend_ProcessBatch(restored, audio.data() + split, rest, &features, &num_frames);
+    TF_LITE_MICRO_EXPECT(!expected.empty());
+    TF_LITE_MICRO_EXPECT_EQ(num_frames * kMicroFrontendFeatureSize, expected.size());
+    TF_LITE_MICRO_EXPECT(std::memcmp(features, expected.data(),
+                                     expected.size() * sizeof(uint16_t)) == 0);
+    MicroFrontend_Free(restored);
+}
+
+TF_LITE_MICRO_TEST(MicroFrontendTest_BatchMatchesChunks) {
+    const std::vector<int16_t> audio = MakeAudio(3);
+    MicroFrontendHandle *chunked = MicroFrontend_Create();
+    const std::vector<uint16_t> expected = RunChunks(chunked, audio);
+    MicroFrontend_Free(chunked);
+
+    MicroFrontendHandle *batch = MicroFrontend_Create();
+    const uint16_t *features = nullptr;
+    size_t num_frames = 0;
+    const size_t consumed = MicroFrontend_ProcessBatch(batch, audio.data(), audio.size(),
+                                                       &features, &num_frames);
+    TF_LITE_MICRO_EXPECT_EQ(consumed, audio.size());
+    TF_LITE_MICRO_EXPECT_EQ(num_frames * kMicroFrontendFeatureSize, expected.size());
+    TF_LITE_MICRO_EXPECT(std::memcmp(features, expected.data(),
+                                     expected.size() * sizeof(uint16_t)) == 0);
+    MicroFrontend_Free(batch);
+}
+
+TF_LITE_MICRO_TEST(MicroFrontendTest_TensorOutputsFillPerConsumer) {
+    MicroFrontendHandle *frontend = MicroFrontend_Create();
+    const int consumer = MicroFrontend_AddConsumer(frontend);
+    float tensor[3 * kMicroFrontendFeatureSize];
+    const int id = MicroFrontend_AddTensorOutput(frontend, consumer, tensor, sizeof(tensor),
+                                                 kMicroFrontendTensorFloat32, 0.0f, 0);
+    TF_LITE_MICRO_EXPECT_EQ(id, 0);
+    TF_LITE_MICRO_EXPECT_EQ(MicroFrontend_AddTensorOutput(frontend, consumer, tensor,
+                                                          sizeof(tensor),
+                                                          kMicroFrontendTensorInt8, 0.0f, 0),
+                            -1);
+
+    // Three frames need 480 + 2 * 160 samples; the tensor is reported full
+    // exactly when the third one is written.
+    const std::vector<int16_t> audio = MakeAudio(4);
+    uint32_t ready_mask = 0;
+    size_t consumed = MicroFrontend_ProcessToTensors(frontend, audio.data(), 799, &ready_mask);
+    TF_LITE_MICRO_EXPECT_EQ(ready_mask, 0u);
+    consumed += MicroFrontend_ProcessToTensors(frontend, audio.data() + consumed,
+                                               audio.size() - consumed, &ready_mask);
+    TF_LITE_MICRO_EXPECT_EQ(ready_mask, 1u);
+    TF_LITE_MICRO_EXPECT_EQ(consumed, 800u);
+
+    MicroFrontend_RemoveConsumer(frontend, consumer);
+    MicroFrontend_ProcessToTensors(frontend, audio.data() + consumed, audio.size() - consumed,
+                                   &ready_mask);
+    TF_LITE_MICRO_EXPECT_EQ(ready_mask, 0u);
+    MicroFrontend_Free(frontend);
+}
+
+TF_LITE_MICRO_TEST(NoiseSuppressorTest_ResetRestartsStream) {
+    NoiseSuppressorHandle *suppressor = NoiseSuppressor_Create();
+    TF_LITE_MICRO_EXPECT(suppressor != nullptr);
+    TF_LITE_MICRO_EXPECT_EQ(NoiseSuppressor_Init(suppressor, 11025), -1);
+    TF_LITE_MICRO_EXPECT_EQ(NoiseSuppressor_Init(suppressor, kMicroFrontendSampleRate), 0);
+    TF_LITE_MICRO_EXPECT_EQ(NoiseSuppressor_SetPolicy(suppressor, 2), 0);
+    TF_LITE_MICRO_EXPECT_EQ(NoiseSuppressor_FrameSize(suppressor), 160u);
+
+    const std::vector<int16_t> audio = MakeAudio(5);
+    const std::vector<int16_t> first = RunSuppressor(suppressor, audio);
+    const float probability = NoiseSuppressor_SpeechProbability(suppressor);
+    TF_LITE_MICRO_EXPECT(probability >= 0.0f && probability <= 1.0f);
+    TF_LITE_MICRO_EXPECT(first != audio);
+
+    TF_LITE_MICRO_EXPECT_EQ(NoiseSuppressor_Reset(suppressor), 0);
+    const std::vector<int16_t> second = RunSuppressor(suppressor, audio);
+    TF_LITE_MICRO_EXPECT(first == second);
+
+    // Processing in place gives the same samples.
+    TF_LITE_MICRO_EXPECT_EQ(NoiseSuppressor_Reset(suppressor), 0);
+    std::vector<int16_t> in_place = audio;
+    for (size_t offset = 0; offset + 160 <= in_place.size(); offset += 160) {
+        NoiseSuppressor_Process(suppressor, in_place.data() + offset,
+                                in_place.data() + offset);
+    }
+    TF_LITE_MICRO_EXPECT(first == in_place);
+    NoiseSuppressor_Free(suppressor);
+}
+
+TF_LITE_MICRO_TEST(NoiseSuppressorTest_StreamMatchesFrames) {
+    const std::vector<int16_t> audio = MakeAudio(8);
+    NoiseSuppressorHandle *framed = NoiseSuppressor_Create();
+    NoiseSuppressor_Init(framed, kMicroFrontendSampleRate);
+    NoiseSuppressor_SetPolicy(framed, 1);
+    const std::vector<int16_t> expected = RunSuppressor(framed, audio);
+    NoiseSuppressor_Free(framed);
+
+    // Reads of awkward sizes, including ones shorter than a frame, must
+    // still produce the framed output as one continuous stream.
+    NoiseSuppressorHandle *streamed = NoiseSuppressor_Create();
+    TF_LITE_MICRO_EXPECT_EQ(NoiseSuppressor_ProcessStream(streamed, nullptr, 0), 0u);
+    NoiseSuppressor_Init(streamed, kMicroFrontendSampleRate);
+    NoiseSuppressor_SetPolicy(streamed, 1);
+    const size_t read_sizes[] = {37, 160, 5, 480, 1, 159, 320, 161, 1000, 77};
+    std::vector<int16_t> buffer;
+    std::vector<int16_t> output;
+    size_t offset = 0;
+    for (size_t i = 0; offset < audio.size(); ++i) {
+        const size_t size = std::min(read_sizes[i % 10], audio.size() - offset);
+        buffer.assign(audio.begin() + offset, audio.begin() + offset + size);
+        const size_t written = NoiseSuppressor_ProcessStream(streamed, buffer.data(), size);
+        TF_LITE_MICRO_EXPECT(written <= size);
+        output.insert(output.end(), buffer.begin(), buffer.begin() + written);
+        offset += size;
+        TF_LITE_MICRO_EXPECT(offset - output.size() < 160);
+    }
+    TF_LITE_MICRO_EXPECT_GT(output.size(), audio.size() - 160);
+    TF_LITE_MICRO_EXPECT(std::equal(output.begin(), output.end(), expected.begin()));
+
+    // Frame-sized reads come back whole.
+    TF_LITE_MICRO_EXPECT_EQ(NoiseSuppressor_Reset(streamed), 0);
+    buffer.assign(audio.begin(), audio.begin() + 480);
+    TF_LITE_MICRO_EXPECT_EQ(NoiseSuppressor_ProcessStream(streamed, buffer.data(), 480), 480u);
+    TF_LITE_MICRO_EXPECT(std::equal(buffer.begin(), buffer.end(), expected.begin()));
+    NoiseSuppressor_Free(streamed);
+}
+
+TF_LITE_MICRO_TEST(NoiseSuppressorTest_KernelVariantsMatchScalar) {
+    // Long enough to pass the startup frames and enable the gain map.
+    std::vector<int16_t> audio;
+    for (uint32_t seed = 1; seed <= 3; ++seed) {
+        const std::vector<int16_t> second = MakeAudio(seed);
+        audio.insert(audio.end(), second.begin(), second.end());
+    }
+    const std::vector<int16_t> expected = RunNsKernels(&kNsKernelsScalar, audio);
+    for (int variant = 0; variant < NsKernelsCount(); ++variant) {
+        const NsKernels *kernels = NsKernelsVariant(variant);
+        if ((kernels->required_features & ~CpuFeaturesDetect()) != 0) {
+            continue;
+        }
+        TF_LITE_MICRO_EXPECT(RunNsKernels(kernels, audio) == expected);
+    }
+
+    NoiseSuppressorHandle *suppressor = NoiseSuppressor_Create();
+    TF_LITE_MICRO_EXPECT(strcmp(NoiseSuppressor_KernelVariant(suppressor),
+                                NsKernelsSelect()->name) == 0);
+    NoiseSuppressor_Free(suppressor);
+    MicroFrontendHandle *frontend = MicroFrontend_Create();
+    TF_LITE_MICRO_EXPECT(strcmp(MicroFrontend_KernelVariant(frontend),
+                                FrontendKernelsSelect()->name) == 0);
+    MicroFrontend_Free(frontend);
+}
+
+TF_LITE_MICRO_TEST(NoiseSuppressorTest_FftMatchesOoura) {
+    const std::vector<int16_t> audio = MakeAudio(10);
+    for (size_t length = 128; length <= 256; length *= 2) {
+        // Late in the clip, where the tone is well above the noise.
+        const std::vector<float> signal(audio.end() - length, audio.end());
+        std::vector<float> reference = signal;
+        size_t ip[128] = {0};
+        float w[128];
+        WebRtc_rdft(length, 1, reference.data(), ip, w);
+        float peak = 0.f;
+        for (float value : reference) {
+            peak = std::max(peak, std::fabs(value));
+        }
+
+        std::vector<float> spectrum = signal;
+        kNsKernelsScalar.rdft(spectrum.data(), length);
+        for (size_t i = 0; i < length; ++i) {
+            TF_LITE_MICRO_EXPECT_NEAR(spectrum[i], reference[i], peak * 1e-6f);
+        }
+        std::vector<float> inverse_reference = reference;
+        WebRtc_rdft(length, -1, inverse_reference.data(), ip, w);
+        std::vector<float> inverse = reference;
+        kNsKernelsScalar.inverse_rdft(inverse.data(), length);
+        for (size_t i = 0; i < length; ++i) {
+            TF_LITE_MICRO_EXPECT_NEAR(inverse[i], inverse_reference[i],
+                                      length / 2 * 32768.f * 1e-6f);
+            TF_LITE_MICRO_EXPECT_NEAR(inverse[i] * 2.f / length, signal[i], 0.05f);
+        }
+
+        for (int variant = 0; variant < NsKernelsCount(); ++variant) {
+            const NsKernels *kernels = NsKernelsVariant(variant);
+            if ((kernels->required_features & ~CpuFeaturesDetect()) != 0) {
+                continue;
+            }
+            std::vector<float> data = signal;
+            kernels->rdft(data.data(), length);
+            TF_LITE_MICRO_EXPECT(memcmp(data.data(), spectrum.data(),
+                                        length * sizeof(float)) == 0);
+            data = reference;
+            kernels->inverse_rdft(data.data(), length);
+            TF_LITE_MICRO_EXPECT(memcmp(data.data(), inverse.data(),
+                                        length * sizeof(float)) == 0);
+        }
+    }
+}
+
+TF_LITE_MICRO_TEST(NoiseSuppressorTest_ApproxMathWithinBounds) {
+    std::vector<float> log_in, exp_in;
+    for (float x = 1e-10f; x < 1e10f; x *= 1.001f) {
+        log_in.push_back(x);
+    }
+    for (float x = -87.f; x < 88.f; x += 0.001f) {
+        exp_in.push_back(x);
+    }
+    std::vector<float> log_expected(log_in.size()), exp_expected(exp_in.size());
+    kNsKernelsScalar.approx_log1p(log_in.data(), log_expected.data(), log_in.size());
+    kNsKernelsScalar.approx_exp(exp_in.data(), 1.f, exp_expected.data(), exp_in.size());
+    for (size_t i = 0; i < log_in.size(); ++i) {
+        const double exact = std::log1p((double) log_in[i]);
+        TF_LITE_MICRO_EXPECT(std::fabs(log_expected[i] - exact) <= kNsLog1pErrorBound * exact);
+    }
+    for (size_t i = 0; i < exp_in.size(); ++i) {
+        const double exact = std::exp((double) exp_in[i]);
+        TF_LITE_MICRO_EXPECT(std::fabs(exp_expected[i] - exact) <= kNsExpErrorBound * exact);
+    }
+
+    for (int variant = 0; variant < NsKernelsCount(); ++variant) {
+        const NsKernels *kernels = NsKernelsVariant(variant);
+        if ((kernels->required_features & ~CpuFeaturesDetect()) != 0) {
+            continue;
+        }
+        std::vector<float> log_out(log_in.size()), exp_out(exp_in.size());
+        kernels->approx_log1p(log_in.data(), log_out.data(), log_in.size());
+        kernels->approx_exp(exp_in.data(), 1.f, exp_out.data(), exp_in.size());
+        TF_LITE_MICRO_EXPECT(log_out == log_expected);
+        TF_LITE_MICRO_EXPECT(exp_out == exp_expected);
+    }
+}
+
+TF_LITE_MICRO_TEST(NoiseSuppressorTest_ApproxMathTracksLibm) {
+    std::vector<int16_t> audio;
+    for (uint32_t seed = 11; seed <= 13; ++seed) {
+        const std::vector<int16_t> second = MakeAudio(seed);
+        audio.insert(audio.end(), second.begin(), second.end());
+    }
+    NsKernels libm_kernels = kNsKernelsScalar;
+    libm_kernels.approx_log1p = LibmLog1p;
+    libm_kernels.approx_exp = LibmExp;
+    NsHandle *approx = WebRtcNs_Create();
+    NsHandle *libm = WebRtcNs_Create();
+    for (NsHandle *ns : {approx, libm}) {
+        WebRtcNs_Init(ns, kMicroFrontendSampleRate);
+        WebRtcNs_set_policy(ns, 2);
+    }
+    WebRtcNs_set_kernels(approx, &kNsKernelsScalar);
+    WebRtcNs_set_kernels(libm, &libm_kernels);
+    const size_t frame_size = kMicroFrontendSampleRate / 100;
+    int max_sample_difference = 0;
+    float max_probability_difference = 0.f;
+    for (size_t offset = 0; offset + frame_size <= audio.size(); offset += frame_size) {
+        int16_t approx_frame[160], libm_frame[160];
+        WebRtcNs_AnalyzeProcess(approx, audio.data() + offset, approx_frame);
+        WebRtcNs_AnalyzeProcess(libm, audio.data() + offset, libm_frame);
+        for (size_t i = 0; i < frame_size; ++i) {
+            max_sample_difference = std::max(max_sample_difference,
+                                              std::abs(approx_frame[i] - libm_frame[i]));
+        }
+        const float *approx_probability = ((NoiseSuppressionC *) approx)->speechProb;
+        const float *libm_probability = ((NoiseSuppressionC *) libm)->speechProb;
+        for (size_t i = 0; i < HALF_ANAL_BLOCKL; ++i) {
+            max_probability_difference =
+                    std::max(max_probability_difference,
+                             std::fabs(approx_probability[i] - libm_probability[i]));
+        }
+    }
+    TF_LITE_MICRO_EXPECT_LE(max_sample_difference, 1);
+    TF_LITE_MICRO_EXPECT_LE(max_probability_difference, 1e-6f);
+    WebRtcNs_Free(approx);
+    WebRtcNs_Free(libm);
+}
+
+TF_LITE_MICRO_TEST(NoiseSuppressorTest_FusedMatchesAnalyzeThenProcess) {
+    // Silence in the middle takes the zero energy path of both halves.
+    std::vector<int16_t> audio = MakeAudio(9);
+    std::fill(audio.begin() + 4000, audio.begin() + 4800, 0);
+    const size_t frame_size = kMicroFrontendSampleRate / 100;
+    for (int policy = 0; policy <= 3; ++policy) {
+        NsHandle *fused = WebRtcNs_Create();
+        WebRtcNs_Init(fused, kMicroFrontendSampleRate);
+        WebRtcNs_set_policy(fused, policy);
+        NsHandle *separate = WebRtcNs_Create();
+        WebRtcNs_Init(separate, kMicroFrontendSampleRate);
+        WebRtcNs_set_policy(separate, policy);
+        std::vector<int16_t> fused_output = audio;
+        std::vector<int16_t> separate_output(audio.size());
+        for (size_t offset = 0; offset + frame_size <= audio.size(); offset += frame_size) {
+            WebRtcNs_AnalyzeProcess(fused, fused_output.data() + offset,
+                                    fused_output.data() + offset);
+            const int16_t *in_frame[1] = {audio.data() + offset};
+            int16_t *out_frame[1] = {separate_output.data() + offset};
+            WebRtcNs_Analyze(separate, in_frame[0]);
+            WebRtcNs_Process(separate, in_frame, 1, out_frame);
+        }
+        TF_LITE_MICRO_EXPECT(fused_output == separate_output);
+        TF_LITE_MICRO_EXPECT_EQ(WebRtcNs_prior_speech_probability(fused),
+                                WebRtcNs_prior_speech_probability(separate));
+        WebRtcNs_Free(fused);
+        WebRtcNs_Free(separate);
+    }
+}
+
+TF_LITE_MICRO_TEST(MicroFeaturesTest_StageStatsCountFrames) {
+    MicroFeatures_ResetStageStats();
+    MicroFeaturesStageStats stats[kMicroFeaturesStageCount];
+    MicroFeatures_GetStageStats(stats);
+    for (const MicroFeaturesStageStats &stage : stats) {
+        TF_LITE_MICRO_EXPECT_EQ(stage.frames, 0u);
+        TF_LITE_MICRO_EXPECT_EQ(stage.total_ns, 0u);
+    }
+
+    // Three frames with no tensor registered are computed but dropped.
+    const std::vector<int16_t> audio = MakeAudio(6);
+    MicroFrontendHandle *frontend = MicroFrontend_Create();
+    uint32_t ready_mask = 0;
+    MicroFrontend_ProcessToTensors(frontend, audio.data(), 800, &ready_mask);
+    MicroFrontend_Free(frontend);
+
+    NoiseSuppressorHandle *suppressor = NoiseSuppressor_Create();
+    std::vector<int16_t> output(160);
+    NoiseSuppressor_Process(suppressor, audio.data(), output.data());
+    NoiseSuppressor_Init(suppressor, kMicroFrontendSampleRate);
+    RunSuppressor(suppressor, std::vector<int16_t>(audio.begin(), audio.begin() + 1600));
+    NoiseSuppressor_Free(suppressor);
+
+    MicroFeatures_GetStageStats(stats);
+    const MicroFeaturesStageStats &features = stats[kMicroFeaturesStageFrontend];
+    TF_LITE_MICRO_EXPECT_EQ(features.frames, 3u);
+    TF_LITE_MICRO_EXPECT(features.max_ns > 0 && features.max_ns <= features.total_ns);
+    TF_LITE_MICRO_EXPECT_EQ(stats[kMicroFeaturesStageTensorWrite].frames, 0u);
+    TF_LITE_MICRO_EXPECT_EQ(stats[kMicroFeaturesStageTensorWrite].dropped_frames, 3u);
+    TF_LITE_MICRO_EXPECT_EQ(stats[kMicroFeaturesStageNoiseProcess].frames, 10u);
+    TF_LITE_MICRO_EXPECT_EQ(stats[kMicroFeaturesStageNoiseProcess].dropped_frames, 1u);
+
+    MicroFeatures_ResetStageStats();
+    MicroFeatures_GetStageStats(stats);
+    TF_LITE_MICRO_EXPECT_EQ(stats[kMicroFeaturesStageFrontend].frames, 0u);
+    TF_LITE_MICRO_EXPECT_EQ(stats[kMicroFeaturesStageFrontend].max_ns, 0u);
+    TF_LITE_MICRO_EXPECT_EQ(stats[kMicroFeaturesStageNoiseProcess].dropped_frames, 0u);
+}
+
+TF_LITE_MICRO_TESTS_END
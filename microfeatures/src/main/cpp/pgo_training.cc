@@ -0,0 +1,101 @@
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "microfeatures.h"
+#include "test_signals.h"
+#include "wav_file.h"
+
+// The training run for profile-guided builds. Feeds the clips in testdata/
+// and a few minutes of synthetic audio through the noise suppressor and the
+// frontend the way the wake word pipeline does: 10 ms suppressor frames at
+// every policy, then int8 model tensors filled from the denoised stream.
+// Takes the directory holding this file as its optional argument; without
+// it, or on a device without the clips, only the synthetic audio is used.
+
+namespace {
+
+const char *const kTrainingClips[] = {
+        "testdata/silence.wav",
+        "testdata/speech.wav",
+        "testdata/music.wav",
+        "testdata/white_noise.wav",
+};
+
+const size_t kSyntheticSamples = 30 * kMicroFrontendSampleRate;
+const int kModelFrames = 3;
+
+bool ReadClip(const std::string &path, std::vector<int16_t> *audio) {
+    WavAudio wav;
+    if (!ReadWav(path.c_str(), &wav) || wav.sample_rate != kMicroFrontendSampleRate ||
+        wav.num_channels != 1) {
+        return false;
+    }
+    *audio = wav.samples;
+    return true;
+}
+
+// Returns the number of frames the model tensors were filled with.
+size_t Train(const std::vector<int16_t> &audio, int policy) {
+    NoiseSuppressorHandle *suppressor = NoiseSuppressor_Create();
+    MicroFrontendHandle *frontend = MicroFrontend_Create();
+    if (suppressor == nullptr || frontend == nullptr ||
+        NoiseSuppressor_Init(suppressor, kMicroFrontendSampleRate) != 0 ||
+        NoiseSuppressor_SetPolicy(suppressor, policy) != 0) {
+        NoiseSuppressor_Free(suppressor);
+        MicroFrontend_Free(frontend);
+        return 0;
+    }
+
+    const size_t frame_size = NoiseSuppressor_FrameSize(suppressor);
+    std::vector<int16_t> denoised(audio.size() / frame_size * frame_size);
+    for (size_t offset = 0; offset < denoised.size(); offset += frame_size) {
+        NoiseSuppressor_Process(suppressor, audio.data() + offset, denoised.data() + offset);
+    }
+
+    int8_t tensor[kModelFrames * kMicroFrontendFeatureSize];
+    const int consumer = MicroFrontend_AddConsumer(frontend);
+    MicroFrontend_AddTensorOutput(frontend, consumer, tensor, sizeof(tensor),
+                                  kMicroFrontendTensorInt8, 0.1f, -128);
+    size_t frames = 0;
+    size_t offset = 0;
+    while (offset < denoised.size()) {
+        uint32_t ready_mask = 0;
+        offset += MicroFrontend_ProcessToTensors(frontend, denoised.data() + offset,
+                                                 denoised.size() - offset, &ready_mask);
+        if (ready_mask != 0) {
+            frames += kModelFrames;
+        }
+    }
+
+    MicroFrontend_Free(frontend);
+    NoiseSuppressor_Free(suppressor);
+    return frames;
+}
+
+}
+
+int main(int argc, char **argv) {
+    std::vector<std::vector<int16_t>> corpus;
+    for (const char *clip : kTrainingClips) {
+        std::vector<int16_t> audio;
+        if (argc > 1 && ReadClip(std::string(argv[1]) + "/" + clip, &audio)) {
+            corpus.push_back(audio);
+        }
+    }
+    const size_t num_clips = corpus.size();
+    for (int signal = 0; signal < kTestSignalCount; ++signal) {
+        corpus.push_back(GenerateTestSignal((TestSignal) signal, kSyntheticSamples, 1 + signal));
+    }
+
+    size_t frames = 0;
+    for (int policy = 0; policy <= 2; ++policy) {
+        for (const std::vector<int16_t> &audio : corpus) {
+            frames += Train(audio, policy);
+        }
+    }
+    printf("trained on %zu clips and %zu synthetic signals, %zu feature frames\n", num_clips,
+           corpus.size() - num_clips, frames);
+    return 0;
+}
@@ -0,0 +1,27 @@
+#include "tensorflow/lite/experimental/microfrontend/lib/cpu_features.h"
+
+#if defined(__arm__) && defined(__linux__)
+#include <sys/auxv.h>
+#ifndef HWCAP_NEON
+#define HWCAP_NEON (1 << 12)
+#endif
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+int CpuFeaturesDetect(void) {
+  int features = 0;
+#if defined(__aarch64__)
+  features |= kCpuFeatureNeon;
+#elif defined(__arm__) && defined(__linux__)
+  if (getauxval(AT_HWCAP) & HWCAP_NEON) {
+    features |= kCpuFeatureNeon;
+  }
+#elif defined(__x86_64__) || defined(__i386__)
+  unsigned int eax, ebx, ecx, edx;
+  if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_1)) {
+    features |= kCpuFeatureSse4_1;
+  }
+#endif
+  return features;
+}
@@ -0,0 +1,22 @@
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_CPU_FEATURES_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_CPU_FEATURES_H_
+
+// Instruction set extensions the vector kernels can use, as bits of the
+// value CpuFeaturesDetect returns.
+#define kCpuFeatureNeon 0x1
+#define kCpuFeatureSse4_1 0x2
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Returns the kCpuFeature bits supported by the CPU this process runs on.
+// NEON is part of arm64; on 32-bit ARM it is read from the kernel's hwcaps,
+// and on x86 from cpuid.
+int CpuFeaturesDetect(void);
+
+#ifdef __cplusplus
+}  
+#endif
+
+#endif  
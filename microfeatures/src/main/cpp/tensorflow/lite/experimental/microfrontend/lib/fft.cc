@@ -3,6 +3,8 @@
 
 #include <string.h>
 
+#include "tensorflow/lite/experimental/microfrontend/lib/fft_512.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
 #include "tensorflow/lite/experimental/microfrontend/lib/kiss_fft_int16.h"
 
 void FftCompute(struct FftState* state, const int16_t* input,
@@ -10,6 +12,12 @@ void FftCompute(struct FftState* state, const int16_t* input,
   const size_t input_size = state->input_size;
   const size_t fft_size = state->fft_size;
 
+  if (fft_size == kFft512Size && input_size <= kFft512Size) {
+    state->kernels->fft_512(input, input_size, input_scale_shift,
+                            state->output);
+    return;
+  }
+
   int16_t* fft_input = state->input;
   
   size_t i;
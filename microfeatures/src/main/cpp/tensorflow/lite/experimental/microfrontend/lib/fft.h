@@ -14,6 +14,8 @@ struct complex_int16_t {
   int16_t imag;
 };
 
+struct FrontendKernels;
+
 struct FftState {
   int16_t* input;
   struct complex_int16_t* output;
@@ -21,6 +23,8 @@ struct FftState {
   size_t input_size;
   void* scratch;
   size_t scratch_size;
+  // Chosen for the CPU by FftPopulateState; see frontend_kernels.h.
+  const struct FrontendKernels* kernels;
 };
 
 void FftCompute(struct FftState* state, const int16_t* input,
@@ -0,0 +1,15 @@
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FFT_512_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FFT_512_H_
+
+#include "tensorflow/lite/experimental/microfrontend/lib/fft.h"
+
+// 512-point 16-bit real FFT specialized from kiss_fftr, implemented in
+// fft_512_kernels.h. It performs the same integer operations in the same
+// rounding order as the kissfft build in kiss_fft_int16.cc, so its output is
+// bit-identical, but the radix-4 passes, digit-reversed load and real split
+// are unrolled with precomputed twiddles and vectorized with NEON or SSE4.1
+// in the variants of FrontendKernels that support them.
+
+#define kFft512Size 512
+
+#endif  
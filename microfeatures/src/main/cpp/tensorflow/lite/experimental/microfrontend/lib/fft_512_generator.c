@@ -0,0 +1,80 @@
+#include <math.h>
+#include <stdio.h>
+
+// Writes the twiddle tables used by fft_512.c. The values are computed with
+// the same expressions kiss_fft_alloc and kiss_fftr_alloc use for a 16-bit
+// 512-point real transform, so the two produce identical results.
+
+#define kComplexSize 256
+#define kSampMax 32767
+
+static void WriteTwiddle(FILE* fp, double phase, int* count) {
+  if (*count % 4 == 0) {
+    fprintf(fp, "\n   ");
+  }
+  fprintf(fp, " {%d, %d},", (short)floor(.5 + kSampMax * cos(phase)),
+          (short)floor(.5 + kSampMax * sin(phase)));
+  ++*count;
+}
+
+static void WriteStageTwiddle(FILE* fp, int index, int* count) {
+  const double pi =
+      3.141592653589793238462643383279502884197169399375105820974944;
+  WriteTwiddle(fp, -2 * pi * index / kComplexSize, count);
+}
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr,
+            "%s requires exactly one parameter - the name of the header to "
+            "save\n",
+            argv[0]);
+    return 1;
+  }
+  FILE* fp = fopen(argv[1], "w");
+  if (!fp) {
+    fprintf(stderr, "Failed to open header '%s' for write\n", argv[1]);
+    return 1;
+  }
+
+  fprintf(fp, "// Generated by fft_512_generator.c, do not edit.\n");
+  fprintf(fp, "#ifndef FFT_512_TABLES_H_\n");
+  fprintf(fp, "#define FFT_512_TABLES_H_\n\n");
+  fprintf(fp,
+          "#include "
+          "\"tensorflow/lite/experimental/microfrontend/lib/fft.h\"\n\n");
+
+  // For the radix-4 passes with 4, 16 and 64 butterflies per group: the
+  // first, second and third twiddle of every butterfly, each run contiguous.
+  fprintf(fp,
+          "static const struct complex_int16_t kFft512StageTwiddles[] = {");
+  int count = 0;
+  int m;
+  for (m = 4; m <= kComplexSize / 4; m *= 4) {
+    const int fstride = kComplexSize / (4 * m);
+    int j;
+    for (j = 1; j <= 3; ++j) {
+      int k;
+      for (k = 0; k < m; ++k) {
+        WriteStageTwiddle(fp, j * k * fstride, &count);
+      }
+    }
+  }
+  fprintf(fp, "\n};\n\n");
+
+  fprintf(fp,
+          "static const struct complex_int16_t kFft512SplitTwiddles[] = {");
+  count = 0;
+  int i;
+  for (i = 0; i < kComplexSize / 2; ++i) {
+    WriteTwiddle(fp,
+                 -3.14159265358979323846264338327 *
+                     ((double)(i + 1) / kComplexSize + .5),
+                 &count);
+  }
+  fprintf(fp, "\n};\n\n");
+
+  fprintf(fp, "#endif  // FFT_512_TABLES_H_\n");
+  fclose(fp);
+  return 0;
+}
@@ -0,0 +1,547 @@
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FFT_512_KERNELS_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FFT_512_KERNELS_H_
+
+#include <string.h>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/fft_512.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/fft_512_tables.h"
+
+#if defined(FRONTEND_KERNELS_SCALAR)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define FFT_512_NEON 1
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define FFT_512_SSE4_1 1
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The real input is transformed as kFft512ComplexSize complex pairs by four
+// radix-4 passes, then split into the real spectrum.
+#define kFft512ComplexSize (kFft512Size / 2)
+
+// kissfft's C_FIXDIV multipliers for radix 4 and for the real split,
+// SAMP_MAX / 4 and SAMP_MAX / 2.
+#define kFft512QuarterScale 8191
+#define kFft512HalfScale 16383
+
+// Offsets of the 4, 16 and 64 butterfly passes in kFft512StageTwiddles.
+#define kFft512Pass4Twiddles 0
+#define kFft512Pass16Twiddles 12
+#define kFft512Pass64Twiddles 60
+
+// Reverses the three base-4 digits of a group index in the first pass.
+static inline int Fft512ReverseDigits(int index) {
+  return ((index & 3) << 4) | (index & 12) | (index >> 4);
+}
+
+static inline int16_t Fft512Round(int32_t x) {
+  return (int16_t)((x + (1 << 14)) >> 15);
+}
+
+static inline struct complex_int16_t Fft512Scale(struct complex_int16_t a,
+                                                 int32_t scale) {
+  a.real = Fft512Round(a.real * scale);
+  a.imag = Fft512Round(a.imag * scale);
+  return a;
+}
+
+static inline struct complex_int16_t Fft512Multiply(struct complex_int16_t a,
+                                                    struct complex_int16_t b) {
+  struct complex_int16_t result;
+  result.real = Fft512Round(a.real * b.real - a.imag * b.imag);
+  result.imag = Fft512Round(a.real * b.imag + a.imag * b.real);
+  return result;
+}
+
+static inline struct complex_int16_t Fft512Add(struct complex_int16_t a,
+                                               struct complex_int16_t b) {
+  a.real = (int16_t)(a.real + b.real);
+  a.imag = (int16_t)(a.imag + b.imag);
+  return a;
+}
+
+static inline struct complex_int16_t Fft512Subtract(struct complex_int16_t a,
+                                                    struct complex_int16_t b) {
+  a.real = (int16_t)(a.real - b.real);
+  a.imag = (int16_t)(a.imag - b.imag);
+  return a;
+}
+
+// The kiss_fftr split of bins begin to end, in place.
+static inline void Fft512SplitScalar(struct complex_int16_t* out, int begin,
+                                     int end) {
+  int k;
+  for (k = begin; k <= end; ++k) {
+    struct complex_int16_t fpnk;
+    fpnk.real = out[kFft512ComplexSize - k].real;
+    fpnk.imag = (int16_t)-out[kFft512ComplexSize - k].imag;
+    const struct complex_int16_t fpk = Fft512Scale(out[k], kFft512HalfScale);
+    fpnk = Fft512Scale(fpnk, kFft512HalfScale);
+    const struct complex_int16_t f1k = Fft512Add(fpk, fpnk);
+    const struct complex_int16_t f2k = Fft512Subtract(fpk, fpnk);
+    const struct complex_int16_t tw =
+        Fft512Multiply(f2k, kFft512SplitTwiddles[k - 1]);
+    out[k].real = (f1k.real + tw.real) >> 1;
+    out[k].imag = (f1k.imag + tw.imag) >> 1;
+    out[kFft512ComplexSize - k].real = (f1k.real - tw.real) >> 1;
+    out[kFft512ComplexSize - k].imag = (tw.imag - f1k.imag) >> 1;
+  }
+}
+
+#if defined(FFT_512_NEON)
+
+// Four complex values, deinterleaved.
+typedef int16x4x2_t Fft512Vector;
+
+static inline Fft512Vector Fft512LoadVector(const struct complex_int16_t* in) {
+  return vld2_s16((const int16_t*)in);
+}
+
+static inline void Fft512StoreVector(struct complex_int16_t* out,
+                                     Fft512Vector value) {
+  vst2_s16((int16_t*)out, value);
+}
+
+static inline Fft512Vector Fft512ScaleVector(Fft512Vector a, int16_t scale) {
+  // vqrdmulh is (2 * a * scale + (1 << 15)) >> 16, which only saturates for
+  // -32768 * -32768.
+  a.val[0] = vqrdmulh_n_s16(a.val[0], scale);
+  a.val[1] = vqrdmulh_n_s16(a.val[1], scale);
+  return a;
+}
+
+static inline Fft512Vector Fft512MultiplyVector(Fft512Vector a,
+                                                Fft512Vector b) {
+  Fft512Vector result;
+  result.val[0] = vrshrn_n_s32(
+      vmlsl_s16(vmull_s16(a.val[0], b.val[0]), a.val[1], b.val[1]), 15);
+  result.val[1] = vrshrn_n_s32(
+      vmlal_s16(vmull_s16(a.val[0], b.val[1]), a.val[1], b.val[0]), 15);
+  return result;
+}
+
+static inline Fft512Vector Fft512AddVector(Fft512Vector a, Fft512Vector b) {
+  a.val[0] = vadd_s16(a.val[0], b.val[0]);
+  a.val[1] = vadd_s16(a.val[1], b.val[1]);
+  return a;
+}
+
+static inline Fft512Vector Fft512SubtractVector(Fft512Vector a,
+                                                Fft512Vector b) {
+  a.val[0] = vsub_s16(a.val[0], b.val[0]);
+  a.val[1] = vsub_s16(a.val[1], b.val[1]);
+  return a;
+}
+
+// s5 - j * s4 and s5 + j * s4, the rotation of a forward radix-4 butterfly.
+static inline void Fft512RotateVector(Fft512Vector s5, Fft512Vector s4,
+                                      Fft512Vector* out1,
+                                      Fft512Vector* out3) {
+  out1->val[0] = vadd_s16(s5.val[0], s4.val[1]);
+  out1->val[1] = vsub_s16(s5.val[1], s4.val[0]);
+  out3->val[0] = vsub_s16(s5.val[0], s4.val[1]);
+  out3->val[1] = vadd_s16(s5.val[1], s4.val[0]);
+}
+
+static inline Fft512Vector Fft512LoadInputVector(const int16_t* input,
+                                                 size_t input_size,
+                                                 int16x4_t shift,
+                                                 size_t sample) {
+  Fft512Vector value;
+  if (sample + 8 <= input_size) {
+    value = vld2_s16(input + sample);
+  } else {
+    int16_t padded[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    if (sample < input_size) {
+      memcpy(padded, input + sample, (input_size - sample) * sizeof(*input));
+    }
+    value = vld2_s16(padded);
+  }
+  value.val[0] = vshl_s16(value.val[0], shift);
+  value.val[1] = vshl_s16(value.val[1], shift);
+  return value;
+}
+
+// Swaps rows and columns of a 4x4 block, one half at a time.
+static inline void Fft512TransposeHalf(int16x4_t* rows) {
+  const int16x4x2_t low = vtrn_s16(rows[0], rows[1]);
+  const int16x4x2_t high = vtrn_s16(rows[2], rows[3]);
+  const int32x2x2_t even = vtrn_s32(vreinterpret_s32_s16(low.val[0]),
+                                    vreinterpret_s32_s16(high.val[0]));
+  const int32x2x2_t odd = vtrn_s32(vreinterpret_s32_s16(low.val[1]),
+                                   vreinterpret_s32_s16(high.val[1]));
+  rows[0] = vreinterpret_s16_s32(even.val[0]);
+  rows[1] = vreinterpret_s16_s32(odd.val[0]);
+  rows[2] = vreinterpret_s16_s32(even.val[1]);
+  rows[3] = vreinterpret_s16_s32(odd.val[1]);
+}
+
+static inline void Fft512TransposeVectors(Fft512Vector* values) {
+  int16x4_t real[4] = {values[0].val[0], values[1].val[0], values[2].val[0],
+                       values[3].val[0]};
+  int16x4_t imag[4] = {values[0].val[1], values[1].val[1], values[2].val[1],
+                       values[3].val[1]};
+  Fft512TransposeHalf(real);
+  Fft512TransposeHalf(imag);
+  int i;
+  for (i = 0; i < 4; ++i) {
+    values[i].val[0] = real[i];
+    values[i].val[1] = imag[i];
+  }
+}
+
+static inline Fft512Vector Fft512ConjugateReverseVector(Fft512Vector a) {
+  a.val[0] = vrev64_s16(a.val[0]);
+  a.val[1] = vneg_s16(vrev64_s16(a.val[1]));
+  return a;
+}
+
+static inline Fft512Vector Fft512ReverseVector(Fft512Vector a) {
+  a.val[0] = vrev64_s16(a.val[0]);
+  a.val[1] = vrev64_s16(a.val[1]);
+  return a;
+}
+
+// (f1k + tw) / 2 and the mirrored conj(f1k - tw) / 2, rounded down like
+// HALF_OF.
+static inline void Fft512HalveVector(Fft512Vector f1k, Fft512Vector tw,
+                                     Fft512Vector* out, Fft512Vector* mirror) {
+  out->val[0] = vhadd_s16(f1k.val[0], tw.val[0]);
+  out->val[1] = vhadd_s16(f1k.val[1], tw.val[1]);
+  mirror->val[0] = vhsub_s16(f1k.val[0], tw.val[0]);
+  mirror->val[1] = vhsub_s16(tw.val[1], f1k.val[1]);
+}
+
+#define FFT_512_VECTORIZED 1
+
+#elif defined(FFT_512_SSE4_1)
+
+// Four complex values, interleaved.
+typedef __m128i Fft512Vector;
+
+static inline Fft512Vector Fft512LoadVector(const struct complex_int16_t* in) {
+  return _mm_loadu_si128((const __m128i*)in);
+}
+
+static inline void Fft512StoreVector(struct complex_int16_t* out,
+                                     Fft512Vector value) {
+  _mm_storeu_si128((__m128i*)out, value);
+}
+
+static inline Fft512Vector Fft512ScaleVector(Fft512Vector a, int16_t scale) {
+  // pmulhrsw is ((a * scale >> 14) + 1) >> 1, the same as sround(a * scale).
+  return _mm_mulhrs_epi16(a, _mm_set1_epi16(scale));
+}
+
+static inline Fft512Vector Fft512SwapVector(Fft512Vector a) {
+  return _mm_shuffle_epi8(
+      a, _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13));
+}
+
+static inline Fft512Vector Fft512NegateImagVector(Fft512Vector a) {
+  return _mm_sign_epi16(a, _mm_setr_epi16(1, -1, 1, -1, 1, -1, 1, -1));
+}
+
+static inline Fft512Vector Fft512MultiplyVector(Fft512Vector a,
+                                                Fft512Vector b) {
+  // pmaddwd forms a.real * b.real - a.imag * b.imag and
+  // a.real * b.imag + a.imag * b.real in 32 bits before the single rounding.
+  const __m128i round = _mm_set1_epi32(1 << 14);
+  const __m128i real = _mm_srai_epi32(
+      _mm_add_epi32(_mm_madd_epi16(a, Fft512NegateImagVector(b)), round), 15);
+  const __m128i imag = _mm_srai_epi32(
+      _mm_add_epi32(_mm_madd_epi16(a, Fft512SwapVector(b)), round), 15);
+  return _mm_blend_epi16(real, _mm_slli_epi32(imag, 16), 0xAA);
+}
+
+static inline Fft512Vector Fft512AddVector(Fft512Vector a, Fft512Vector b) {
+  return _mm_add_epi16(a, b);
+}
+
+static inline Fft512Vector Fft512SubtractVector(Fft512Vector a,
+                                                Fft512Vector b) {
+  return _mm_sub_epi16(a, b);
+}
+
+static inline void Fft512RotateVector(Fft512Vector s5, Fft512Vector s4,
+                                      Fft512Vector* out1,
+                                      Fft512Vector* out3) {
+  const __m128i rotated = Fft512NegateImagVector(Fft512SwapVector(s4));
+  *out1 = _mm_add_epi16(s5, rotated);
+  *out3 = _mm_sub_epi16(s5, rotated);
+}
+
+static inline Fft512Vector Fft512LoadInputVector(const int16_t* input,
+                                                 size_t input_size,
+                                                 __m128i shift,
+                                                 size_t sample) {
+  if (sample + 8 <= input_size) {
+    return _mm_sll_epi16(_mm_loadu_si128((const __m128i*)(input + sample)),
+                         shift);
+  }
+  int16_t padded[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  if (sample < input_size) {
+    memcpy(padded, input + sample, (input_size - sample) * sizeof(*input));
+  }
+  return _mm_sll_epi16(_mm_loadu_si128((const __m128i*)padded), shift);
+}
+
+static inline void Fft512TransposeVectors(Fft512Vector* values) {
+  const __m128i low01 = _mm_unpacklo_epi32(values[0], values[1]);
+  const __m128i low23 = _mm_unpacklo_epi32(values[2], values[3]);
+  const __m128i high01 = _mm_unpackhi_epi32(values[0], values[1]);
+  const __m128i high23 = _mm_unpackhi_epi32(values[2], values[3]);
+  values[0] = _mm_unpacklo_epi64(low01, low23);
+  values[1] = _mm_unpackhi_epi64(low01, low23);
+  values[2] = _mm_unpacklo_epi64(high01, high23);
+  values[3] = _mm_unpackhi_epi64(high01, high23);
+}
+
+static inline Fft512Vector Fft512ConjugateReverseVector(Fft512Vector a) {
+  return Fft512NegateImagVector(_mm_shuffle_epi32(a, _MM_SHUFFLE(0, 1, 2, 3)));
+}
+
+static inline Fft512Vector Fft512ReverseVector(Fft512Vector a) {
+  return _mm_shuffle_epi32(a, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+// floor((a + b) / 2) and floor((a - b) / 2) without leaving 16 bits.
+static inline __m128i Fft512HalfAdd(__m128i a, __m128i b) {
+  return _mm_add_epi16(
+      _mm_add_epi16(_mm_srai_epi16(a, 1), _mm_srai_epi16(b, 1)),
+      _mm_and_si128(_mm_and_si128(a, b), _mm_set1_epi16(1)));
+}
+
+static inline __m128i Fft512HalfSubtract(__m128i a, __m128i b) {
+  return _mm_sub_epi16(
+      _mm_sub_epi16(_mm_srai_epi16(a, 1), _mm_srai_epi16(b, 1)),
+      _mm_and_si128(_mm_andnot_si128(a, b), _mm_set1_epi16(1)));
+}
+
+static inline void Fft512HalveVector(Fft512Vector f1k, Fft512Vector tw,
+                                     Fft512Vector* out, Fft512Vector* mirror) {
+  *out = Fft512HalfAdd(f1k, tw);
+  *mirror = Fft512HalfSubtract(_mm_blend_epi16(f1k, tw, 0xAA),
+                               _mm_blend_epi16(tw, f1k, 0xAA));
+}
+
+#define FFT_512_VECTORIZED 1
+
+#endif
+
+#if defined(FFT_512_VECTORIZED)
+
+// Fft512Butterfly on four neighbouring butterflies.
+static inline void Fft512ButterflyVector(Fft512Vector* values,
+                                         Fft512Vector tw1, Fft512Vector tw2,
+                                         Fft512Vector tw3) {
+  Fft512Vector a0 = Fft512ScaleVector(values[0], kFft512QuarterScale);
+  const Fft512Vector a1 = Fft512ScaleVector(values[1], kFft512QuarterScale);
+  const Fft512Vector a2 = Fft512ScaleVector(values[2], kFft512QuarterScale);
+  const Fft512Vector a3 = Fft512ScaleVector(values[3], kFft512QuarterScale);
+
+  const Fft512Vector s0 = Fft512MultiplyVector(a1, tw1);
+  const Fft512Vector s1 = Fft512MultiplyVector(a2, tw2);
+  const Fft512Vector s2 = Fft512MultiplyVector(a3, tw3);
+  const Fft512Vector s5 = Fft512SubtractVector(a0, s1);
+  a0 = Fft512AddVector(a0, s1);
+  const Fft512Vector s3 = Fft512AddVector(s0, s2);
+  const Fft512Vector s4 = Fft512SubtractVector(s0, s2);
+  values[2] = Fft512SubtractVector(a0, s3);
+  values[0] = Fft512AddVector(a0, s3);
+  Fft512RotateVector(s5, s4, &values[1], &values[3]);
+}
+
+static inline void Fft512FirstPass(const int16_t* input, size_t input_size,
+                                   int input_scale_shift,
+                                   struct complex_int16_t* out) {
+#if defined(FFT_512_NEON)
+  const int16x4_t shift = vdup_n_s16(input_scale_shift);
+#else
+  const __m128i shift = _mm_cvtsi32_si128(input_scale_shift);
+#endif
+  const struct complex_int16_t unit[4] = {
+      kFft512StageTwiddles[0], kFft512StageTwiddles[0],
+      kFft512StageTwiddles[0], kFft512StageTwiddles[0]};
+  const Fft512Vector tw = Fft512LoadVector(unit);
+  // Four groups with consecutive reversed indices share their input loads;
+  // their outputs land 16 groups apart once transposed.
+  int index;
+  for (index = 0; index < kFft512ComplexSize / 4; index += 4) {
+    Fft512Vector values[4];
+    int t;
+    for (t = 0; t < 4; ++t) {
+      values[t] = Fft512LoadInputVector(
+          input, input_size, shift, 2 * (index + t * kFft512ComplexSize / 4));
+    }
+    Fft512ButterflyVector(values, tw, tw, tw);
+    Fft512TransposeVectors(values);
+    struct complex_int16_t* group_out = out + 4 * Fft512ReverseDigits(index);
+    for (t = 0; t < 4; ++t) {
+      Fft512StoreVector(group_out + t * kFft512ComplexSize / 4, values[t]);
+    }
+  }
+}
+
+static inline void Fft512Pass(struct complex_int16_t* out, int m,
+                              const struct complex_int16_t* twiddles) {
+  int base;
+  for (base = 0; base < kFft512ComplexSize; base += 4 * m) {
+    int k;
+    for (k = 0; k < m; k += 4) {
+      struct complex_int16_t* butterfly_out = out + base + k;
+      Fft512Vector values[4];
+      int t;
+      for (t = 0; t < 4; ++t) {
+        values[t] = Fft512LoadVector(butterfly_out + t * m);
+      }
+      Fft512ButterflyVector(values, Fft512LoadVector(twiddles + k),
+                            Fft512LoadVector(twiddles + m + k),
+                            Fft512LoadVector(twiddles + 2 * m + k));
+      for (t = 0; t < 4; ++t) {
+        Fft512StoreVector(butterfly_out + t * m, values[t]);
+      }
+    }
+  }
+}
+
+// Bins 1 to 124 four at a time, together with their mirrors 255 to 132; the
+// rest, including bin 128 which is its own mirror, are left to the scalar
+// loop.
+#define kFft512SplitVectorEnd 124
+
+static inline void Fft512Split(struct complex_int16_t* out) {
+  int k;
+  for (k = 1; k <= kFft512SplitVectorEnd; k += 4) {
+    struct complex_int16_t* mirror_out = out + kFft512ComplexSize - k - 3;
+    const Fft512Vector fpk =
+        Fft512ScaleVector(Fft512LoadVector(out + k), kFft512HalfScale);
+    const Fft512Vector fpnk = Fft512ScaleVector(
+        Fft512ConjugateReverseVector(Fft512LoadVector(mirror_out)),
+        kFft512HalfScale);
+    const Fft512Vector f1k = Fft512AddVector(fpk, fpnk);
+    const Fft512Vector tw =
+        Fft512MultiplyVector(Fft512SubtractVector(fpk, fpnk),
+                             Fft512LoadVector(kFft512SplitTwiddles + k - 1));
+    Fft512Vector value;
+    Fft512Vector mirror;
+    Fft512HalveVector(f1k, tw, &value, &mirror);
+    Fft512StoreVector(out + k, value);
+    Fft512StoreVector(mirror_out, Fft512ReverseVector(mirror));
+  }
+  Fft512SplitScalar(out, kFft512SplitVectorEnd + 1, kFft512ComplexSize / 2);
+}
+
+#else
+
+// kf_bfly4 for a forward transform, on the four values out[0], out[m],
+// out[2 * m] and out[3 * m].
+static inline void Fft512Butterfly(struct complex_int16_t* out, int m,
+                                   struct complex_int16_t tw1,
+                                   struct complex_int16_t tw2,
+                                   struct complex_int16_t tw3) {
+  struct complex_int16_t a0 = Fft512Scale(out[0], kFft512QuarterScale);
+  const struct complex_int16_t a1 = Fft512Scale(out[m], kFft512QuarterScale);
+  const struct complex_int16_t a2 =
+      Fft512Scale(out[2 * m], kFft512QuarterScale);
+  const struct complex_int16_t a3 =
+      Fft512Scale(out[3 * m], kFft512QuarterScale);
+
+  const struct complex_int16_t s0 = Fft512Multiply(a1, tw1);
+  const struct complex_int16_t s1 = Fft512Multiply(a2, tw2);
+  const struct complex_int16_t s2 = Fft512Multiply(a3, tw3);
+  const struct complex_int16_t s5 = Fft512Subtract(a0, s1);
+  a0 = Fft512Add(a0, s1);
+  const struct complex_int16_t s3 = Fft512Add(s0, s2);
+  const struct complex_int16_t s4 = Fft512Subtract(s0, s2);
+  out[2 * m] = Fft512Subtract(a0, s3);
+  out[0] = Fft512Add(a0, s3);
+  out[m].real = (int16_t)(s5.real + s4.imag);
+  out[m].imag = (int16_t)(s5.imag - s4.real);
+  out[3 * m].real = (int16_t)(s5.real - s4.imag);
+  out[3 * m].imag = (int16_t)(s5.imag + s4.real);
+}
+
+static inline struct complex_int16_t Fft512LoadInput(const int16_t* input,
+                                                     size_t input_size,
+                                                     int input_scale_shift,
+                                                     int index) {
+  struct complex_int16_t value = {0, 0};
+  const size_t sample = 2 * (size_t)index;
+  if (sample < input_size) {
+    value.real = (int16_t)((uint16_t)input[sample] << input_scale_shift);
+  }
+  if (sample + 1 < input_size) {
+    value.imag = (int16_t)((uint16_t)input[sample + 1] << input_scale_shift);
+  }
+  return value;
+}
+
+// The single-butterfly groups of the first pass, reading the digit-reversed
+// input directly.
+static inline void Fft512FirstPass(const int16_t* input, size_t input_size,
+                                   int input_scale_shift,
+                                   struct complex_int16_t* out) {
+  int group;
+  for (group = 0; group < kFft512ComplexSize / 4; ++group) {
+    const int index = Fft512ReverseDigits(group);
+    struct complex_int16_t* group_out = out + 4 * group;
+    int t;
+    for (t = 0; t < 4; ++t) {
+      group_out[t] = Fft512LoadInput(input, input_size, input_scale_shift,
+                                     index + t * kFft512ComplexSize / 4);
+    }
+    Fft512Butterfly(group_out, 1, kFft512StageTwiddles[0],
+                    kFft512StageTwiddles[0], kFft512StageTwiddles[0]);
+  }
+}
+
+static inline void Fft512Pass(struct complex_int16_t* out, int m,
+                              const struct complex_int16_t* twiddles) {
+  int base;
+  for (base = 0; base < kFft512ComplexSize; base += 4 * m) {
+    int k;
+    for (k = 0; k < m; ++k) {
+      Fft512Butterfly(out + base + k, m, twiddles[k], twiddles[m + k],
+                      twiddles[2 * m + k]);
+    }
+  }
+}
+
+static inline void Fft512Split(struct complex_int16_t* out) {
+  Fft512SplitScalar(out, 1, kFft512ComplexSize / 2);
+}
+
+#endif
+
+// Shifts the first input_size samples of input left by input_scale_shift,
+// zero pads them to kFft512Size and writes the kFft512Size / 2 + 1 bins to
+// output. input_size must not exceed kFft512Size.
+static inline void Fft512Compute(const int16_t* input, size_t input_size,
+                                 int input_scale_shift,
+                                 struct complex_int16_t* output) {
+  Fft512FirstPass(input, input_size, input_scale_shift, output);
+  Fft512Pass(output, 4, kFft512StageTwiddles + kFft512Pass4Twiddles);
+  Fft512Pass(output, 16, kFft512StageTwiddles + kFft512Pass16Twiddles);
+  Fft512Pass(output, 64, kFft512StageTwiddles + kFft512Pass64Twiddles);
+
+  // The complex transform is in output[0, kFft512ComplexSize); split it into
+  // the real spectrum in place.
+  const struct complex_int16_t tdc =
+      Fft512Scale(output[0], kFft512HalfScale);
+  output[0].real = tdc.real + tdc.imag;
+  output[0].imag = 0;
+  output[kFft512ComplexSize].real = tdc.real - tdc.imag;
+  output[kFft512ComplexSize].imag = 0;
+  Fft512Split(output);
+}
+
+#ifdef __cplusplus
+}  
+#endif
+
+#endif  
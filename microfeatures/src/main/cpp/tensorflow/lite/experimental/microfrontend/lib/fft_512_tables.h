@@ -0,0 +1,108 @@
+// Generated by fft_512_generator.c, do not edit.
+#ifndef FFT_512_TABLES_H_
+#define FFT_512_TABLES_H_
+
+#include "tensorflow/lite/experimental/microfrontend/lib/fft.h"
+
+static const struct complex_int16_t kFft512StageTwiddles[] = {
+    {32767, 0}, {30273, -12539}, {23170, -23170}, {12539, -30273},
+    {32767, 0}, {23170, -23170}, {0, -32767}, {-23170, -23170},
+    {32767, 0}, {12539, -30273}, {-23170, -23170}, {-30273, 12539},
+    {32767, 0}, {32609, -3212}, {32137, -6393}, {31356, -9512},
+    {30273, -12539}, {28898, -15446}, {27245, -18204}, {25329, -20787},
+    {23170, -23170}, {20787, -25329}, {18204, -27245}, {15446, -28898},
+    {12539, -30273}, {9512, -31356}, {6393, -32137}, {3212, -32609},
+    {32767, 0}, {32137, -6393}, {30273, -12539}, {27245, -18204},
+    {23170, -23170}, {18204, -27245}, {12539, -30273}, {6393, -32137},
+    {0, -32767}, {-6393, -32137}, {-12539, -30273}, {-18204, -27245},
+    {-23170, -23170}, {-27245, -18204}, {-30273, -12539}, {-32137, -6393},
+    {32767, 0}, {31356, -9512}, {27245, -18204}, {20787, -25329},
+    {12539, -30273}, {3212, -32609}, {-6393, -32137}, {-15446, -28898},
+    {-23170, -23170}, {-28898, -15446}, {-32137, -6393}, {-32609, 3212},
+    {-30273, 12539}, {-25329, 20787}, {-18204, 27245}, {-9512, 31356},
+    {32767, 0}, {32757, -804}, {32728, -1608}, {32678, -2410},
+    {32609, -3212}, {32521, -4011}, {32412, -4808}, {32285, -5602},
+    {32137, -6393}, {31971, -7179}, {31785, -7962}, {31580, -8739},
+    {31356, -9512}, {31113, -10278}, {30852, -11039}, {30571, -11793},
+    {30273, -12539}, {29956, -13279}, {29621, -14010}, {29268, -14732},
+    {28898, -15446}, {28510, -16151}, {28105, -16846}, {27683, -17530},
+    {27245, -18204}, {26790, -18868}, {26319, -19519}, {25832, -20159},
+    {25329, -20787}, {24811, -21403}, {24279, -22005}, {23731, -22594},
+    {23170, -23170}, {22594, -23731}, {22005, -24279}, {21403, -24811},
+    {20787, -25329}, {20159, -25832}, {19519, -26319}, {18868, -26790},
+    {18204, -27245}, {17530, -27683}, {16846, -28105}, {16151, -28510},
+    {15446, -28898}, {14732, -29268}, {14010, -29621}, {13279, -29956},
+    {12539, -30273}, {11793, -30571}, {11039, -30852}, {10278, -31113},
+    {9512, -31356}, {8739, -31580}, {7962, -31785}, {7179, -31971},
+    {6393, -32137}, {5602, -32285}, {4808, -32412}, {4011, -32521},
+    {3212, -32609}, {2410, -32678}, {1608, -32728}, {804, -32757},
+    {32767, 0}, {32728, -1608}, {32609, -3212}, {32412, -4808},
+    {32137, -6393}, {31785, -7962}, {31356, -9512}, {30852, -11039},
+    {30273, -12539}, {29621, -14010}, {28898, -15446}, {28105, -16846},
+    {27245, -18204}, {26319, -19519}, {25329, -20787}, {24279, -22005},
+    {23170, -23170}, {22005, -24279}, {20787, -25329}, {19519, -26319},
+    {18204, -27245}, {16846, -28105}, {15446, -28898}, {14010, -29621},
+    {12539, -30273}, {11039, -30852}, {9512, -31356}, {7962, -31785},
+    {6393, -32137}, {4808, -32412}, {3212, -32609}, {1608, -32728},
+    {0, -32767}, {-1608, -32728}, {-3212, -32609}, {-4808, -32412},
+    {-6393, -32137}, {-7962, -31785}, {-9512, -31356}, {-11039, -30852},
+    {-12539, -30273}, {-14010, -29621}, {-15446, -28898}, {-16846, -28105},
+    {-18204, -27245}, {-19519, -26319}, {-20787, -25329}, {-22005, -24279},
+    {-23170, -23170}, {-24279, -22005}, {-25329, -20787}, {-26319, -19519},
+    {-27245, -18204}, {-28105, -16846}, {-28898, -15446}, {-29621, -14010},
+    {-30273, -12539}, {-30852, -11039}, {-31356, -9512}, {-31785, -7962},
+    {-32137, -6393}, {-32412, -4808}, {-32609, -3212}, {-32728, -1608},
+    {32767, 0}, {32678, -2410}, {32412, -4808}, {31971, -7179},
+    {31356, -9512}, {30571, -11793}, {29621, -14010}, {28510, -16151},
+    {27245, -18204}, {25832, -20159}, {24279, -22005}, {22594, -23731},
+    {20787, -25329}, {18868, -26790}, {16846, -28105}, {14732, -29268},
+    {12539, -30273}, {10278, -31113}, {7962, -31785}, {5602, -32285},
+    {3212, -32609}, {804, -32757}, {-1608, -32728}, {-4011, -32521},
+    {-6393, -32137}, {-8739, -31580}, {-11039, -30852}, {-13279, -29956},
+    {-15446, -28898}, {-17530, -27683}, {-19519, -26319}, {-21403, -24811},
+    {-23170, -23170}, {-24811, -21403}, {-26319, -19519}, {-27683, -17530},
+    {-28898, -15446}, {-29956, -13279}, {-30852, -11039}, {-31580, -8739},
+    {-32137, -6393}, {-32521, -4011}, {-32728, -1608}, {-32757, 804},
+    {-32609, 3212}, {-32285, 5602}, {-31785, 7962}, {-31113, 10278},
+    {-30273, 12539}, {-29268, 14732}, {-28105, 16846}, {-26790, 18868},
+    {-25329, 20787}, {-23731, 22594}, {-22005, 24279}, {-20159, 25832},
+    {-18204, 27245}, {-16151, 28510}, {-14010, 29621}, {-11793, 30571},
+    {-9512, 31356}, {-7179, 31971}, {-4808, 32412}, {-2410, 32678},
+};
+
+static const struct complex_int16_t kFft512SplitTwiddles[] = {
+    {-402, -32765}, {-804, -32757}, {-1206, -32745}, {-1608, -32728},
+    {-2009, -32705}, {-2410, -32678}, {-2811, -32646}, {-3212, -32609},
+    {-3612, -32567}, {-4011, -32521}, {-4410, -32469}, {-4808, -32412},
+    {-5205, -32351}, {-5602, -32285}, {-5998, -32213}, {-6393, -32137},
+    {-6786, -32057}, {-7179, -31971}, {-7571, -31880}, {-7962, -31785},
+    {-8351, -31685}, {-8739, -31580}, {-9126, -31470}, {-9512, -31356},
+    {-9896, -31237}, {-10278, -31113}, {-10659, -30985}, {-11039, -30852},
+    {-11417, -30714}, {-11793, -30571}, {-12167, -30424}, {-12539, -30273},
+    {-12910, -30117}, {-13279, -29956}, {-13645, -29791}, {-14010, -29621},
+    {-14372, -29447}, {-14732, -29268}, {-15090, -29085}, {-15446, -28898},
+    {-15800, -28706}, {-16151, -28510}, {-16499, -28310}, {-16846, -28105},
+    {-17189, -27896}, {-17530, -27683}, {-17869, -27466}, {-18204, -27245},
+    {-18537, -27019}, {-18868, -26790}, {-19195, -26556}, {-19519, -26319},
+    {-19841, -26077}, {-20159, -25832}, {-20475, -25582}, {-20787, -25329},
+    {-21096, -25072}, {-21403, -24811}, {-21705, -24547}, {-22005, -24279},
+    {-22301, -24007}, {-22594, -23731}, {-22884, -23452}, {-23170, -23170},
+    {-23452, -22884}, {-23731, -22594}, {-24007, -22301}, {-24279, -22005},
+    {-24547, -21705}, {-24811, -21403}, {-25072, -21096}, {-25329, -20787},
+    {-25582, -20475}, {-25832, -20159}, {-26077, -19841}, {-26319, -19519},
+    {-26556, -19195}, {-26790, -18868}, {-27019, -18537}, {-27245, -18204},
+    {-27466, -17869}, {-27683, -17530}, {-27896, -17189}, {-28105, -16846},
+    {-28310, -16499}, {-28510, -16151}, {-28706, -15800}, {-28898, -15446},
+    {-29085, -15090}, {-29268, -14732}, {-29447, -14372}, {-29621, -14010},
+    {-29791, -13645}, {-29956, -13279}, {-30117, -12910}, {-30273, -12539},
+    {-30424, -12167}, {-30571, -11793}, {-30714, -11417}, {-30852, -11039},
+    {-30985, -10659}, {-31113, -10278}, {-31237, -9896}, {-31356, -9512},
+    {-31470, -9126}, {-31580, -8739}, {-31685, -8351}, {-31785, -7962},
+    {-31880, -7571}, {-31971, -7179}, {-32057, -6786}, {-32137, -6393},
+    {-32213, -5998}, {-32285, -5602}, {-32351, -5205}, {-32412, -4808},
+    {-32469, -4410}, {-32521, -4011}, {-32567, -3612}, {-32609, -3212},
+    {-32646, -2811}, {-32678, -2410}, {-32705, -2009}, {-32728, -1608},
+    {-32745, -1206}, {-32757, -804}, {-32765, -402}, {-32767, 0},
+};
+
+#endif  // FFT_512_TABLES_H_
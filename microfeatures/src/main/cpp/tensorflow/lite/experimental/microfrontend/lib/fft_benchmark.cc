@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/fft.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/fft_512.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/fft_util.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/kiss_fft_int16.h"
+
+// Times one 480-sample window through the 512-point real FFT, with the
+// generic kissfft path and with the specialized FFT of every kernel variant
+// the CPU supports.
+
+namespace {
+
+const int kWindowSize = 480;
+const int kScaleShift = 3;
+const int kIterations = 200000;
+
+double NowNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+void KissFftCompute(struct FftState* state, const int16_t* input) {
+  int i;
+  for (i = 0; i < kWindowSize; ++i) {
+    state->input[i] = static_cast<int16_t>(static_cast<uint16_t>(input[i])
+                                           << kScaleShift);
+  }
+  for (; i < kFft512Size; ++i) {
+    state->input[i] = 0;
+  }
+  kissfft_fixed16::kiss_fftr(
+      reinterpret_cast<kissfft_fixed16::kiss_fftr_cfg>(state->scratch),
+      state->input,
+      reinterpret_cast<kissfft_fixed16::kiss_fft_cpx*>(state->output));
+}
+
+}
+
+int main() {
+  struct FftState state;
+  if (!FftPopulateState(&state, kWindowSize)) {
+    fprintf(stderr, "Failed to populate FFT state\n");
+    return 1;
+  }
+
+  int16_t input[kWindowSize];
+  uint32_t seed = 1;
+  for (int i = 0; i < kWindowSize; ++i) {
+    seed = seed * 1103515245 + 12345;
+    input[i] = static_cast<int16_t>(seed >> 20);
+  }
+  int16_t initial_input[kWindowSize];
+  memcpy(initial_input, input, sizeof(input));
+
+  // Pass 0 is kissfft, pass 1 + n the specialized FFT of variant n.
+  int failed = 0;
+  uint64_t kiss_checksum = 0;
+  double kiss_elapsed = 0;
+  for (int pass = 0; pass <= FrontendKernelsCount(); ++pass) {
+    const struct FrontendKernels* kernels =
+        pass > 0 ? FrontendKernelsVariant(pass - 1) : nullptr;
+    if (kernels != nullptr && !FrontendKernelsSupported(kernels)) {
+      continue;
+    }
+    memcpy(input, initial_input, sizeof(input));
+    uint64_t checksum = 0;
+    const double start = NowNs();
+    for (int iteration = 0; iteration < kIterations; ++iteration) {
+      input[iteration % kWindowSize] ^= 1;
+      if (kernels != nullptr) {
+        kernels->fft_512(input, kWindowSize, kScaleShift, state.output);
+      } else {
+        KissFftCompute(&state, input);
+      }
+      const struct complex_int16_t bin = state.output[iteration % 257];
+      checksum += static_cast<uint16_t>(bin.real) +
+                  (static_cast<uint32_t>(bin.imag) << 16);
+    }
+    const double elapsed = (NowNs() - start) / kIterations;
+    if (kernels == nullptr) {
+      kiss_checksum = checksum;
+      kiss_elapsed = elapsed;
+      printf("fft %-12s %8.1f ns/frame\n", "kissfft", elapsed);
+      continue;
+    }
+    printf("fft %-12s %8.1f ns/frame (%.2fx)\n", kernels->name, elapsed,
+           kiss_elapsed / elapsed);
+    if (checksum != kiss_checksum) {
+      fprintf(stderr, "%s FFT output differs from kissfft\n", kernels->name);
+      failed = 1;
+    }
+  }
+
+  FftFreeStateContents(&state);
+  return failed;
+}
@@ -1,7 +1,10 @@
 
 #include "tensorflow/lite/experimental/microfrontend/lib/fft.h"
 
+#include "tensorflow/lite/experimental/microfrontend/lib/fft_512.h"
 #include "tensorflow/lite/experimental/microfrontend/lib/fft_util.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/kiss_fft_int16.h"
 #include "tensorflow/lite/micro/testing/micro_test.h"
 
 namespace {
@@ -11,6 +14,11 @@ const int16_t kFakeWindow[] = {
     0, -28328, 0, 21447, 0, -13312, 0, 5943,   0, -1152, 0};
 const int kScaleShift = 0;
 
+uint32_t NextRandom(uint32_t* seed) {
+  *seed = *seed * 1103515245 + 12345;
+  return *seed >> 16;
+}
+
 }  
 
 TF_LITE_MICRO_TESTS_BEGIN
@@ -38,4 +46,56 @@ TF_LITE_MICRO_TEST(FftTest_CheckOutputValues) {
   FftFreeStateContents(&state);
 }
 
+TF_LITE_MICRO_TEST(FftTest_Fft512MatchesKissFft) {
+  struct FftState state;
+  TF_LITE_MICRO_EXPECT(FftPopulateState(&state, kFft512Size));
+
+  int16_t input[kFft512Size];
+  struct complex_int16_t output[kFft512Size / 2 + 1];
+  const size_t input_sizes[] = {480, 512, 400, 1, 0};
+  uint32_t seed = 1;
+  int iteration;
+  for (iteration = 0; iteration < 3000; ++iteration) {
+    const size_t input_size = input_sizes[iteration % 5];
+    const int input_scale_shift = iteration % 16;
+    const int kind = (iteration / 5) % 3;
+    size_t i;
+    for (i = 0; i < kFft512Size; ++i) {
+      const uint32_t random = NextRandom(&seed);
+      if (kind == 0) {
+        input[i] = static_cast<int16_t>(random);
+      } else if (kind == 1) {
+        input[i] = (random & 1) ? 32767 : -32768;
+      } else {
+        input[i] = static_cast<int16_t>(random) >> input_scale_shift;
+      }
+    }
+
+    for (i = 0; i < kFft512Size; ++i) {
+      state.input[i] =
+          i < input_size ? static_cast<int16_t>(static_cast<uint16_t>(input[i])
+                                                << input_scale_shift)
+                         : 0;
+    }
+    kissfft_fixed16::kiss_fftr(
+        reinterpret_cast<kissfft_fixed16::kiss_fftr_cfg>(state.scratch),
+        state.input,
+        reinterpret_cast<kissfft_fixed16::kiss_fft_cpx*>(state.output));
+    int variant;
+    for (variant = 0; variant < FrontendKernelsCount(); ++variant) {
+      const struct FrontendKernels* kernels = FrontendKernelsVariant(variant);
+      if (!FrontendKernelsSupported(kernels)) {
+        continue;
+      }
+      kernels->fft_512(input, input_size, input_scale_shift, output);
+      for (i = 0; i <= kFft512Size / 2; ++i) {
+        TF_LITE_MICRO_EXPECT_EQ(output[i].real, state.output[i].real);
+        TF_LITE_MICRO_EXPECT_EQ(output[i].imag, state.output[i].imag);
+      }
+    }
+  }
+
+  FftFreeStateContents(&state);
+}
+
 TF_LITE_MICRO_TESTS_END
@@ -3,6 +3,7 @@
 
 #include <stdio.h>
 
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
 #include "tensorflow/lite/experimental/microfrontend/lib/kiss_fft_int16.h"
 
 int FftPopulateState(struct FftState* state, size_t input_size) {
@@ -47,6 +48,25 @@ int FftPopulateState(struct FftState* state, size_t input_size) {
     fprintf(stderr, "Kiss memory preallocation strategy failed.\n");
     return 0;
   }
+  state->kernels = FrontendKernelsSelect();
+  return 1;
+}
+
+size_t FftScratchSize(size_t fft_size) {
+  size_t scratch_size = 0;
+  kissfft_fixed16::kiss_fftr_alloc(fft_size, 0, nullptr, &scratch_size);
+  return scratch_size;
+}
+
+int FftInitScratch(struct FftState* state, void* scratch) {
+  size_t scratch_size = state->scratch_size;
+  kissfft_fixed16::kiss_fftr_cfg kfft_cfg = kissfft_fixed16::kiss_fftr_alloc(
+      state->fft_size, 0, scratch, &scratch_size);
+  if (kfft_cfg != scratch) {
+    fprintf(stderr, "Kiss memory preallocation strategy failed.\n");
+    return 0;
+  }
+  state->scratch = scratch;
   return 1;
 }
 
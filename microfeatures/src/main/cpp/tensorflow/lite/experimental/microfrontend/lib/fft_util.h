@@ -14,6 +14,12 @@ int FftPopulateState(struct FftState* state, size_t input_size);
 
 void FftFreeStateContents(struct FftState* state);
 
+size_t FftScratchSize(size_t fft_size);
+
+// Rebuilds the kissfft config inside scratch, which must hold at least
+// state->scratch_size bytes. The previous scratch is not freed.
+int FftInitScratch(struct FftState* state, void* scratch);
+
 #ifdef __cplusplus
 }  
 #endif
@@ -13,6 +13,8 @@
 extern "C" {
 #endif
 
+struct FrontendKernels;
+
 struct FilterbankState {
   int num_channels;
   int start_index;
@@ -23,6 +25,8 @@ struct FilterbankState {
   int16_t* weights;
   int16_t* unweights;
   uint64_t* work;
+  // Chosen for the CPU by FilterbankPopulateState; see frontend_kernels.h.
+  const struct FrontendKernels* kernels;
 };
 
 
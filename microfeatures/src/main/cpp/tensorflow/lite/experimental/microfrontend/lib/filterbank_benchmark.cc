@@ -0,0 +1,90 @@
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/filterbank.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/filterbank_util.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
+
+// Times the filterbank energy, channel accumulation and square root for one
+// 512-point frame with the 40 channel wake word configuration, with every
+// kernel variant the CPU supports against the scalar one.
+
+namespace {
+
+const int kSampleRate = 16000;
+const int kFftSize = 512;
+const int kSpectrumSize = kFftSize / 2 + 1;
+const int kIterations = 200000;
+
+double NowNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+}
+
+int main() {
+  struct FilterbankConfig config;
+  FilterbankFillConfigWithDefaults(&config);
+  config.num_channels = 40;
+  config.lower_band_limit = 125.0;
+  config.upper_band_limit = 7500.0;
+  struct FilterbankState state;
+  if (!FilterbankPopulateState(&config, &state, kSampleRate, kSpectrumSize)) {
+    fprintf(stderr, "Failed to populate filterbank state\n");
+    return 1;
+  }
+
+  struct complex_int16_t fft_output[kSpectrumSize];
+  uint32_t seed = 1;
+  for (int i = 0; i < kSpectrumSize; ++i) {
+    seed = seed * 1103515245 + 12345;
+    fft_output[i].real = static_cast<int16_t>(seed >> 18);
+    seed = seed * 1103515245 + 12345;
+    fft_output[i].imag = static_cast<int16_t>(seed >> 18);
+  }
+  struct complex_int16_t initial_fft_output[kSpectrumSize];
+  memcpy(initial_fft_output, fft_output, sizeof(fft_output));
+  int32_t energy[kSpectrumSize];
+  const int count = state.end_index - state.start_index;
+
+  int failed = 0;
+  uint64_t scalar_checksum = 0;
+  double scalar_elapsed = 0;
+  for (int variant = 0; variant < FrontendKernelsCount(); ++variant) {
+    const struct FrontendKernels* kernels = FrontendKernelsVariant(variant);
+    if (!FrontendKernelsSupported(kernels)) {
+      continue;
+    }
+    memcpy(fft_output, initial_fft_output, sizeof(fft_output));
+    uint64_t checksum = 0;
+    const double start = NowNs();
+    for (int iteration = 0; iteration < kIterations; ++iteration) {
+      fft_output[iteration % kSpectrumSize].real ^= 1;
+      kernels->filterbank_energy(fft_output + state.start_index,
+                                 energy + state.start_index, count);
+      kernels->filterbank_accumulate(&state, energy);
+      const uint32_t* channels =
+          kernels->filterbank_sqrt(&state, iteration % 8);
+      checksum += channels[iteration % state.num_channels];
+    }
+    const double elapsed = (NowNs() - start) / kIterations;
+    if (variant == 0) {
+      scalar_checksum = checksum;
+      scalar_elapsed = elapsed;
+    }
+    printf("filterbank %-8s %8.1f ns/frame (%.2fx)\n", kernels->name, elapsed,
+           scalar_elapsed / elapsed);
+    if (checksum != scalar_checksum) {
+      fprintf(stderr, "%s filterbank output differs from scalar\n",
+              kernels->name);
+      failed = 1;
+    }
+  }
+
+  FilterbankFreeStateContents(&state);
+  return failed;
+}
@@ -0,0 +1,236 @@
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FILTERBANK_KERNELS_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FILTERBANK_KERNELS_H_
+
+#include <stdint.h>
+
+#include <math.h>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/fft.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/filterbank.h"
+
+#if defined(FRONTEND_KERNELS_SCALAR)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define FILTERBANK_KERNELS_NEON 1
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define FILTERBANK_KERNELS_SSE4_1 1
+#endif
+
+// Inner loops of the filterbank. They are compiled once per instruction set
+// in the frontend_kernels_*.c variants; the vector versions give
+// bit-identical results to the scalar ones, which are kept as the reference
+// for tests and benchmarks.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline void FilterbankEnergyScalar(
+    const struct complex_int16_t* fft_output, int32_t* energy, int count) {
+  int i;
+  for (i = 0; i < count; ++i) {
+    const int32_t real = fft_output[i].real;
+    const int32_t imag = fft_output[i].imag;
+    energy[i] = (uint32_t)(real * real) + (uint32_t)(imag * imag);
+  }
+}
+
+// Accumulates width magnitudes, a multiple of kFilterbankChannelBlockSize,
+// against the weights and unweights of one channel.
+static inline void FilterbankChannelScalar(const int32_t* magnitudes,
+                                           const int16_t* weights,
+                                           const int16_t* unweights, int width,
+                                           uint64_t* weight_accumulator,
+                                           uint64_t* unweight_accumulator) {
+  uint64_t weight_sum = *weight_accumulator;
+  uint64_t unweight_sum = *unweight_accumulator;
+  int j;
+  for (j = 0; j < width; ++j) {
+    weight_sum += weights[j] * ((uint64_t)magnitudes[j]);
+    unweight_sum += unweights[j] * ((uint64_t)magnitudes[j]);
+  }
+  *weight_accumulator = weight_sum;
+  *unweight_accumulator = unweight_sum;
+}
+
+// energy may alias fft_output: each element is read before the same four
+// bytes are written.
+static inline void FilterbankEnergy(const struct complex_int16_t* fft_output,
+                                    int32_t* energy, int count) {
+  int i = 0;
+#if defined(FILTERBANK_KERNELS_NEON)
+  for (; i + 4 <= count; i += 4) {
+    const int16x4x2_t values = vld2_s16((const int16_t*)(fft_output + i));
+    int32x4_t sum = vmull_s16(values.val[0], values.val[0]);
+    sum = vmlal_s16(sum, values.val[1], values.val[1]);
+    vst1q_s32(energy + i, sum);
+  }
+#elif defined(FILTERBANK_KERNELS_SSE4_1)
+  for (; i + 4 <= count; i += 4) {
+    const __m128i values = _mm_loadu_si128((const __m128i*)(fft_output + i));
+    _mm_storeu_si128((__m128i*)(energy + i), _mm_madd_epi16(values, values));
+  }
+#endif
+  FilterbankEnergyScalar(fft_output + i, energy + i, count - i);
+}
+
+static inline void FilterbankChannel(const int32_t* magnitudes,
+                                     const int16_t* weights,
+                                     const int16_t* unweights, int width,
+                                     uint64_t* weight_accumulator,
+                                     uint64_t* unweight_accumulator) {
+#if defined(FILTERBANK_KERNELS_NEON)
+  // The products are int32 x int16 and summed modulo 2^64, which is what the
+  // scalar uint64_t arithmetic does after sign extension.
+  int64x2_t weight_sum = vdupq_n_s64(0);
+  int64x2_t unweight_sum = vdupq_n_s64(0);
+  int j;
+  for (j = 0; j < width; j += 4) {
+    const int32x4_t magnitude = vld1q_s32(magnitudes + j);
+    const int32x4_t weight = vmovl_s16(vld1_s16(weights + j));
+    const int32x4_t unweight = vmovl_s16(vld1_s16(unweights + j));
+    weight_sum = vmlal_s32(weight_sum, vget_low_s32(magnitude),
+                           vget_low_s32(weight));
+    weight_sum = vmlal_s32(weight_sum, vget_high_s32(magnitude),
+                           vget_high_s32(weight));
+    unweight_sum = vmlal_s32(unweight_sum, vget_low_s32(magnitude),
+                             vget_low_s32(unweight));
+    unweight_sum = vmlal_s32(unweight_sum, vget_high_s32(magnitude),
+                             vget_high_s32(unweight));
+  }
+  *weight_accumulator += (uint64_t)vgetq_lane_s64(weight_sum, 0) +
+                         (uint64_t)vgetq_lane_s64(weight_sum, 1);
+  *unweight_accumulator += (uint64_t)vgetq_lane_s64(unweight_sum, 0) +
+                           (uint64_t)vgetq_lane_s64(unweight_sum, 1);
+#elif defined(FILTERBANK_KERNELS_SSE4_1)
+  __m128i weight_sum = _mm_setzero_si128();
+  __m128i unweight_sum = _mm_setzero_si128();
+  int j;
+  for (j = 0; j < width; j += 4) {
+    const __m128i magnitude =
+        _mm_loadu_si128((const __m128i*)(magnitudes + j));
+    const __m128i weight =
+        _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)(weights + j)));
+    const __m128i unweight =
+        _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)(unweights + j)));
+    const __m128i magnitude_odd = _mm_srli_epi64(magnitude, 32);
+    weight_sum = _mm_add_epi64(weight_sum, _mm_mul_epi32(magnitude, weight));
+    weight_sum = _mm_add_epi64(
+        weight_sum, _mm_mul_epi32(magnitude_odd, _mm_srli_epi64(weight, 32)));
+    unweight_sum =
+        _mm_add_epi64(unweight_sum, _mm_mul_epi32(magnitude, unweight));
+    unweight_sum = _mm_add_epi64(
+        unweight_sum,
+        _mm_mul_epi32(magnitude_odd, _mm_srli_epi64(unweight, 32)));
+  }
+  weight_sum = _mm_add_epi64(weight_sum, _mm_unpackhi_epi64(weight_sum,
+                                                            weight_sum));
+  unweight_sum = _mm_add_epi64(unweight_sum,
+                               _mm_unpackhi_epi64(unweight_sum, unweight_sum));
+  uint64_t sums[2];
+  _mm_storel_epi64((__m128i*)&sums[0], weight_sum);
+  _mm_storel_epi64((__m128i*)&sums[1], unweight_sum);
+  *weight_accumulator += sums[0];
+  *unweight_accumulator += sums[1];
+#else
+  FilterbankChannelScalar(magnitudes, weights, unweights, width,
+                          weight_accumulator, unweight_accumulator);
+#endif
+}
+
+static inline void FilterbankAccumulate(struct FilterbankState* state,
+                                        const int32_t* energy) {
+  uint64_t* work = state->work;
+  uint64_t weight_accumulator = 0;
+  uint64_t unweight_accumulator = 0;
+
+  const int16_t* channel_frequency_starts = state->channel_frequency_starts;
+  const int16_t* channel_weight_starts = state->channel_weight_starts;
+  const int16_t* channel_widths = state->channel_widths;
+
+  int num_channels_plus_1 = state->num_channels + 1;
+  int i;
+  for (i = 0; i < num_channels_plus_1; ++i) {
+    const int32_t* magnitudes = energy + *channel_frequency_starts++;
+    const int16_t* weights = state->weights + *channel_weight_starts;
+    const int16_t* unweights = state->unweights + *channel_weight_starts++;
+    const int width = *channel_widths++;
+    FilterbankChannel(magnitudes, weights, unweights, width,
+                      &weight_accumulator, &unweight_accumulator);
+    *work++ = weight_accumulator;
+    weight_accumulator = unweight_accumulator;
+    unweight_accumulator = 0;
+  }
+}
+
+// Square root of num rounded to the nearest integer and capped at 0xFFFF for
+// 32-bit values or 0xFFFFFFFF above, given root, the FPU root truncated to an
+// integer. root is corrected to the exact floor root, which matches the
+// bit-by-bit digit recurrence this replaced, including its rounding: round up
+// when the remainder exceeds the floor root, unless that would exceed the
+// cap.
+static inline uint32_t FilterbankRoundedSqrt(uint64_t num, uint64_t root) {
+  const uint32_t max = (num >> 32) == 0 ? 0xFFFF : 0xFFFFFFFF;
+  if (root > max) {
+    root = max;
+  }
+  while (root * root > num) {
+    --root;
+  }
+  uint64_t remainder = num - root * root;
+  while (remainder > 2 * root && root < max) {
+    remainder -= 2 * root + 1;
+    ++root;
+  }
+  // Rounds either way about half the time, so keep it free of branches
+  // whatever a profile suggests.
+  root += (remainder > root) & (root != max);
+  return (uint32_t)root;
+}
+
+// The square roots of the channels in state->work, shifted down and written
+// over the start of it. Each output is written after the work value it
+// overlaps has been read.
+static inline uint32_t* FilterbankSqrtChannels(struct FilterbankState* state,
+                                               int scale_down_shift) {
+  const int num_channels = state->num_channels;
+  const uint64_t* work = state->work + 1;
+  uint32_t* output = (uint32_t*)state->work;
+  int i = 0;
+#if defined(FILTERBANK_KERNELS_NEON) && defined(__aarch64__)
+  for (; i + 2 <= num_channels; i += 2) {
+    const uint64x2_t roots =
+        vcvtq_u64_f64(vsqrtq_f64(vcvtq_f64_u64(vld1q_u64(work + i))));
+    const uint32_t first =
+        FilterbankRoundedSqrt(work[i], vgetq_lane_u64(roots, 0));
+    const uint32_t second =
+        FilterbankRoundedSqrt(work[i + 1], vgetq_lane_u64(roots, 1));
+    output[i] = first >> scale_down_shift;
+    output[i + 1] = second >> scale_down_shift;
+  }
+#elif defined(FILTERBANK_KERNELS_SSE4_1)
+  for (; i + 2 <= num_channels; i += 2) {
+    double roots[2];
+    _mm_storeu_pd(roots, _mm_sqrt_pd(_mm_setr_pd((double)work[i],
+                                                 (double)work[i + 1])));
+    const uint32_t first = FilterbankRoundedSqrt(work[i], (uint64_t)roots[0]);
+    const uint32_t second =
+        FilterbankRoundedSqrt(work[i + 1], (uint64_t)roots[1]);
+    output[i] = first >> scale_down_shift;
+    output[i + 1] = second >> scale_down_shift;
+  }
+#endif
+  for (; i < num_channels; ++i) {
+    const uint32_t root =
+        FilterbankRoundedSqrt(work[i], (uint64_t)sqrt((double)work[i]));
+    output[i] = root >> scale_down_shift;
+  }
+  return (uint32_t*)state->work;
+}
+
+#ifdef __cplusplus
+}  
+#endif
+
+#endif  
@@ -3,7 +3,9 @@
 
 #include <cstring>
 
+#include "tensorflow/lite/experimental/microfrontend/lib/bits.h"
 #include "tensorflow/lite/experimental/microfrontend/lib/filterbank_util.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
 #include "tensorflow/lite/micro/testing/micro_test.h"
 
 namespace {
@@ -17,6 +19,94 @@ const int32_t kEnergy[] = {-1,     181,      400,      181,      625,    28322,
                            625,    181,      361,      -1,       -1};
 const uint64_t kWork[] = {1835887, 61162970173, 258694800000};
 const int kScaleShift = 0;
+const int kNumSqrtChannels = 40;
+
+uint32_t NextRandom(uint32_t* seed) {
+  *seed = *seed * 1103515245 + 12345;
+  return *seed;
+}
+
+// The bit-by-bit square root FilterbankSqrt used to call, kept as the
+// reference for its replacement.
+uint16_t ReferenceSqrt32(uint32_t num) {
+  if (num == 0) {
+    return 0;
+  }
+  uint32_t res = 0;
+  int max_bit_number = 32 - MostSignificantBit32(num);
+  max_bit_number |= 1;
+  uint32_t bit = 1U << (31 - max_bit_number);
+  int iterations = (31 - max_bit_number) / 2 + 1;
+  while (iterations--) {
+    if (num >= res + bit) {
+      num -= res + bit;
+      res = (res >> 1U) + bit;
+    } else {
+      res >>= 1U;
+    }
+    bit >>= 2U;
+  }
+  
+  if (num > res && res != 0xFFFF) {
+    ++res;
+  }
+  return res;
+}
+
+uint32_t ReferenceSqrt64(uint64_t num) {
+  
+  
+  
+  if ((num >> 32) == 0) {
+    return ReferenceSqrt32((uint32_t)num);
+  }
+  uint64_t res = 0;
+  int max_bit_number = 64 - MostSignificantBit64(num);
+  max_bit_number |= 1;
+  uint64_t bit = 1ULL << (63 - max_bit_number);
+  int iterations = (63 - max_bit_number) / 2 + 1;
+  while (iterations--) {
+    if (num >= res + bit) {
+      num -= res + bit;
+      res = (res >> 1U) + bit;
+    } else {
+      res >>= 1U;
+    }
+    bit >>= 2U;
+  }
+  
+  if (num > res && res != 0xFFFFFFFFLL) {
+    ++res;
+  }
+  return res;
+}
+
+// Runs values through the square root of every kernel variant the CPU
+// supports, a channel at a time, and checks them against the reference.
+bool SqrtMatchesReference(const uint64_t* values, int count) {
+  uint64_t work[kNumSqrtChannels + 1];
+  struct FilterbankState state;
+  state.num_channels = kNumSqrtChannels;
+  state.work = work;
+  for (int variant = 0; variant < FrontendKernelsCount(); ++variant) {
+    const struct FrontendKernels* kernels = FrontendKernelsVariant(variant);
+    if (!FrontendKernelsSupported(kernels)) {
+      continue;
+    }
+    for (int offset = 0; offset < count; offset += kNumSqrtChannels) {
+      for (int i = 0; i < kNumSqrtChannels; ++i) {
+        work[i + 1] = values[(offset + i) % count];
+      }
+      const uint32_t* result = kernels->filterbank_sqrt(&state, 0);
+      for (int i = 0; i < kNumSqrtChannels; ++i) {
+        if (result[i] != ReferenceSqrt64(values[(offset + i) % count])) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
 
 
 class FilterbankTestConfig {
@@ -149,6 +239,7 @@ TF_LITE_MICRO_TEST(FilterbankTest_CheckConvertFftComplexToEnergy) {
   struct FilterbankState state;
   state.start_index = kStartIndex;
   state.end_index = kEndIndex;
+  state.kernels = FrontendKernelsSelect();
 
   struct complex_int16_t fake_fft[] = {
       {0, 0},    {-10, 9},     {-20, 0},   {-9, -10},     {0, 25},  {-119, 119},
@@ -201,4 +292,116 @@ TF_LITE_MICRO_TEST(FilterbankTest_CheckSqrt) {
   FilterbankFreeStateContents(&state);
 }
 
+TF_LITE_MICRO_TEST(FilterbankTest_EnergyKernelMatchesScalar) {
+  const int kCount = 259;
+  struct complex_int16_t fft_output[kCount];
+  uint32_t seed = 1;
+  for (int i = 0; i < kCount; ++i) {
+    fft_output[i].real = static_cast<int16_t>(NextRandom(&seed) >> 16);
+    fft_output[i].imag = static_cast<int16_t>(NextRandom(&seed) >> 16);
+  }
+  fft_output[0].real = fft_output[0].imag = -32768;
+  fft_output[1].real = 32767;
+  fft_output[1].imag = -32768;
+
+  int32_t expected[kCount];
+  kFrontendKernelsScalar.filterbank_energy(fft_output, expected, kCount);
+  for (int variant = 0; variant < FrontendKernelsCount(); ++variant) {
+    const struct FrontendKernels* kernels = FrontendKernelsVariant(variant);
+    if (!FrontendKernelsSupported(kernels)) {
+      continue;
+    }
+    // In place, the way the frontend calls it.
+    struct complex_int16_t buffer[kCount];
+    memcpy(buffer, fft_output, sizeof(buffer));
+    int32_t* energy = reinterpret_cast<int32_t*>(buffer);
+    kernels->filterbank_energy(buffer, energy, kCount);
+    for (int i = 0; i < kCount; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(energy[i], expected[i]);
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(FilterbankTest_AccumulateKernelMatchesScalar) {
+  struct FilterbankConfig config;
+  FilterbankFillConfigWithDefaults(&config);
+  config.num_channels = 40;
+  config.lower_band_limit = 125.0;
+  config.upper_band_limit = 7500.0;
+  struct FilterbankState state;
+  TF_LITE_MICRO_EXPECT(
+      FilterbankPopulateState(&config, &state, 16000, 512 / 2 + 1));
+
+  const int kCount = 512 / 2 + 1;
+  int32_t energy[kCount];
+  uint32_t seed = 7;
+  for (int i = 0; i < kCount; ++i) {
+    energy[i] = static_cast<int32_t>(NextRandom(&seed));
+  }
+  energy[state.start_index] = -1;
+  energy[state.start_index + 1] = INT32_MIN;
+
+  uint64_t expected[40 + 1];
+  kFrontendKernelsScalar.filterbank_accumulate(&state, energy);
+  memcpy(expected, state.work, sizeof(expected));
+  for (int variant = 0; variant < FrontendKernelsCount(); ++variant) {
+    const struct FrontendKernels* kernels = FrontendKernelsVariant(variant);
+    if (!FrontendKernelsSupported(kernels)) {
+      continue;
+    }
+    memset(state.work, 0, sizeof(expected));
+    kernels->filterbank_accumulate(&state, energy);
+    for (int i = 0; i <= 40; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(state.work[i], expected[i]);
+    }
+  }
+
+  FilterbankFreeStateContents(&state);
+}
+
+TF_LITE_MICRO_TEST(FilterbankTest_SqrtMatchesReferenceAtBoundaries) {
+  // Values around k^2 and k^2 + k, where the floor root and the rounding
+  // change, for roots near every power of two and at the 16 and 32 bit caps.
+  const int kMaxValues = 32 * 4 * 7 + 6;
+  static uint64_t values[kMaxValues];
+  int count = 0;
+  for (int bits = 0; bits < 32; ++bits) {
+    const uint64_t roots[] = {(1ULL << bits) - 1, (1ULL << bits),
+                              (1ULL << bits) + 1, (3ULL << bits) / 2};
+    for (uint64_t root : roots) {
+      if (root > 0xFFFFFFFFULL) {
+        root = 0xFFFFFFFFULL;
+      }
+      const uint64_t square = root * root;
+      const uint64_t candidates[] = {square - 1, square,     square + 1,
+                                     square + root - 1, square + root,
+                                     square + root + 1, square + 2 * root};
+      for (uint64_t value : candidates) {
+        values[count++] = value;
+      }
+    }
+  }
+  values[count++] = 0;
+  values[count++] = 0xFFFFFFFFULL;
+  values[count++] = 0x100000000ULL;
+  values[count++] = 0xFFFFFFFFFFFFFFFFULL;
+  values[count++] = 0xFFFE0001ULL;
+  values[count++] = 0xFFFFFFFE00000001ULL;
+  TF_LITE_MICRO_EXPECT(SqrtMatchesReference(values, count));
+}
+
+TF_LITE_MICRO_TEST(FilterbankTest_SqrtMatchesReferenceForRandomValues) {
+  const int kNumValues = 1 << 16;
+  static uint64_t values[kNumValues];
+  uint32_t seed = 3;
+  for (int round = 0; round < 16; ++round) {
+    for (int i = 0; i < kNumValues; ++i) {
+      const uint64_t high = NextRandom(&seed);
+      const uint64_t low = NextRandom(&seed);
+      values[i] = ((high << 32) | low) >> (NextRandom(&seed) % 64);
+    }
+    TF_LITE_MICRO_EXPECT(SqrtMatchesReference(values, kNumValues));
+  }
+}
+
 TF_LITE_MICRO_TESTS_END
@@ -5,6 +5,8 @@
 #include <math.h>
 #include <stdio.h>
 
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
+
 #define kFilterbankIndexAlignment 4
 #define kFilterbankChannelBlockSize 4
 
@@ -194,6 +196,7 @@ int FilterbankPopulateState(const struct FilterbankConfig* config,
     fprintf(stderr, "Filterbank end_index is above spectrum size.\n");
     return 0;
   }
+  state->kernels = FrontendKernelsSelect();
   return 1;
 }
 
@@ -1,7 +1,10 @@
 
 #include "tensorflow/lite/experimental/microfrontend/lib/frontend.h"
 
+#include <string.h>
+
 #include "tensorflow/lite/experimental/microfrontend/lib/bits.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/trace.h"
 
 struct FrontendOutput FrontendProcessSamples(struct FrontendState* state,
                                              const int16_t* samples,
@@ -12,18 +15,24 @@ struct FrontendOutput FrontendProcessSamples(struct FrontendState* state,
   output.size = 0;
 
   
-  if (!WindowProcessSamples(&state->window, samples, num_samples,
-                            num_samples_read)) {
+  TRACE_BEGIN("frontend.window");
+  const int windowed = WindowProcessSamples(&state->window, samples,
+                                            num_samples, num_samples_read);
+  TRACE_END();
+  if (!windowed) {
     return output;
   }
 
   
   
+  TRACE_BEGIN("frontend.fft");
   int input_shift =
       15 - MostSignificantBit32(state->window.max_abs_output_value);
   FftCompute(&state->fft, state->window.output, input_shift);
+  TRACE_END();
 
   
+  TRACE_BEGIN("frontend.filterbank");
   int32_t* energy = (int32_t*)state->fft.output;
 
   FilterbankConvertFftComplexToEnergy(&state->filterbank, state->fft.output,
@@ -31,19 +40,32 @@ struct FrontendOutput FrontendProcessSamples(struct FrontendState* state,
 
   FilterbankAccumulateChannels(&state->filterbank, energy);
   uint32_t* scaled_filterbank = FilterbankSqrt(&state->filterbank, input_shift);
-
-  NoiseReductionApply(&state->noise_reduction, scaled_filterbank);
-
-  if (state->pcan_gain_control.enable_pcan) {
-    PcanGainControlApply(&state->pcan_gain_control, scaled_filterbank);
-  }
+  TRACE_END();
 
   
+  TRACE_BEGIN("frontend.post_filterbank");
   int correction_bits =
       MostSignificantBit32(state->fft.fft_size) - 1 - (kFilterbankBits / 2);
-  uint16_t* logged_filterbank =
-      LogScaleApply(&state->log_scale, scaled_filterbank,
-                    state->filterbank.num_channels, correction_bits);
+  uint16_t* logged_filterbank;
+  if (state->pcan_gain_control.enable_pcan && state->log_scale.enable_log &&
+      state->pcan_gain_control.noise_estimate ==
+          state->noise_reduction.estimate) {
+    logged_filterbank = state->kernels->post_filterbank_apply(
+        &state->noise_reduction, &state->pcan_gain_control, &state->log_scale,
+        correction_bits, scaled_filterbank);
+  } else {
+    NoiseReductionApply(&state->noise_reduction, scaled_filterbank);
+
+    if (state->pcan_gain_control.enable_pcan) {
+      PcanGainControlApply(&state->pcan_gain_control, scaled_filterbank);
+    }
+
+    logged_filterbank =
+        LogScaleApply(&state->log_scale, scaled_filterbank,
+                      state->filterbank.num_channels, correction_bits);
+  }
+
+  TRACE_END();
 
   output.size = state->filterbank.num_channels;
   output.values = logged_filterbank;
@@ -56,3 +78,102 @@ void FrontendReset(struct FrontendState* state) {
   FilterbankReset(&state->filterbank);
   NoiseReductionReset(&state->noise_reduction);
 }
+
+void FrontendSetKernels(struct FrontendState* state,
+                        const struct FrontendKernels* kernels) {
+  state->window.kernels = kernels;
+  state->fft.kernels = kernels;
+  state->filterbank.kernels = kernels;
+  state->kernels = kernels;
+}
+
+#define kFrontendSnapshotMagic 0x5346464D  // "MFFS"
+#define kFrontendSnapshotVersion 1
+
+// Followed by the input_used window samples, oldest first, and the
+// num_channels noise estimates.
+struct FrontendSnapshotHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t num_channels;
+  uint32_t window_size;
+  uint32_t window_step;
+  uint32_t input_used;
+};
+
+static size_t SnapshotSize(const struct FrontendState* state,
+                           size_t input_used) {
+  return sizeof(struct FrontendSnapshotHeader) +
+         input_used * sizeof(*state->window.input) +
+         state->noise_reduction.num_channels *
+             sizeof(*state->noise_reduction.estimate);
+}
+
+size_t FrontendSaveStateSize(const struct FrontendState* state) {
+  return SnapshotSize(state, state->window.input_used);
+}
+
+size_t FrontendSaveState(const struct FrontendState* state, void* buffer,
+                         size_t capacity) {
+  const struct WindowState* window = &state->window;
+  const size_t size = SnapshotSize(state, window->input_used);
+  if (capacity < size) {
+    return 0;
+  }
+  struct FrontendSnapshotHeader header;
+  header.magic = kFrontendSnapshotMagic;
+  header.version = kFrontendSnapshotVersion;
+  header.num_channels = (uint16_t)state->noise_reduction.num_channels;
+  header.window_size = (uint32_t)window->size;
+  header.window_step = (uint32_t)window->step;
+  header.input_used = (uint32_t)window->input_used;
+  char* cursor = buffer;
+  memcpy(cursor, &header, sizeof(header));
+  cursor += sizeof(header);
+
+  // The samples are unwrapped from the ring so the restored window starts
+  // at the beginning of its buffer.
+  size_t first_copy = window->size - window->input_start;
+  if (first_copy > window->input_used) {
+    first_copy = window->input_used;
+  }
+  memcpy(cursor, window->input + window->input_start,
+         first_copy * sizeof(*window->input));
+  cursor += first_copy * sizeof(*window->input);
+  memcpy(cursor, window->input,
+         (window->input_used - first_copy) * sizeof(*window->input));
+  cursor += (window->input_used - first_copy) * sizeof(*window->input);
+
+  memcpy(cursor, state->noise_reduction.estimate,
+         state->noise_reduction.num_channels *
+             sizeof(*state->noise_reduction.estimate));
+  return size;
+}
+
+int FrontendRestoreState(struct FrontendState* state, const void* data,
+                         size_t size) {
+  struct FrontendSnapshotHeader header;
+  if (size < sizeof(header)) {
+    return 0;
+  }
+  memcpy(&header, data, sizeof(header));
+  struct WindowState* window = &state->window;
+  if (header.magic != kFrontendSnapshotMagic ||
+      header.version != kFrontendSnapshotVersion ||
+      header.num_channels != state->noise_reduction.num_channels ||
+      header.window_size != window->size ||
+      header.window_step != window->step ||
+      header.input_used >= window->size ||
+      size != SnapshotSize(state, header.input_used)) {
+    return 0;
+  }
+  const char* cursor = (const char*)data + sizeof(header);
+  memcpy(window->input, cursor, header.input_used * sizeof(*window->input));
+  cursor += header.input_used * sizeof(*window->input);
+  window->input_start = 0;
+  window->input_used = header.input_used;
+  memcpy(state->noise_reduction.estimate, cursor,
+         state->noise_reduction.num_channels *
+             sizeof(*state->noise_reduction.estimate));
+  return 1;
+}
@@ -7,6 +7,7 @@
 
 #include "tensorflow/lite/experimental/microfrontend/lib/fft.h"
 #include "tensorflow/lite/experimental/microfrontend/lib/filterbank.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
 #include "tensorflow/lite/experimental/microfrontend/lib/log_scale.h"
 #include "tensorflow/lite/experimental/microfrontend/lib/noise_reduction.h"
 #include "tensorflow/lite/experimental/microfrontend/lib/pcan_gain_control.h"
@@ -23,6 +24,13 @@ struct FrontendState {
   struct NoiseReductionState noise_reduction;
   struct PcanGainControlState pcan_gain_control;
   struct LogScaleState log_scale;
+  // The kernels of every stage; see FrontendSetKernels.
+  const struct FrontendKernels* kernels;
+  // Single block holding every buffer above, or NULL if they are separately
+  // allocated. See FrontendPopulateState. arena_size counts the bytes held
+  // either way.
+  void* arena;
+  size_t arena_size;
 };
 
 struct FrontendOutput {
@@ -44,6 +52,30 @@ struct FrontendOutput FrontendProcessSamples(struct FrontendState* state,
 
 void FrontendReset(struct FrontendState* state);
 
+// Runs every stage with the given kernels instead of the ones picked for the
+// CPU when the state was populated. They must be supported by the CPU.
+void FrontendSetKernels(struct FrontendState* state,
+                        const struct FrontendKernels* kernels);
+
+// The adaptive part of a state, the noise estimate that also drives PCAN and
+// the samples waiting in the window, can be saved to a blob and restored
+// into another state with the same window and channel count, so a new
+// frontend continues where an old one stopped instead of adapting from
+// zero. States from FrontendPopulateState and FrontendFixedPopulateState
+// with the same configuration are interchangeable.
+
+// Bytes FrontendSaveState needs for this state.
+size_t FrontendSaveStateSize(const struct FrontendState* state);
+
+// Returns the number of bytes written, or 0 if capacity is too small.
+size_t FrontendSaveState(const struct FrontendState* state, void* buffer,
+                         size_t capacity);
+
+// Returns 1, or 0 without touching state if the blob was saved from a state
+// with a different layout or is truncated.
+int FrontendRestoreState(struct FrontendState* state, const void* data,
+                         size_t size);
+
 #ifdef __cplusplus
 }  
 #endif
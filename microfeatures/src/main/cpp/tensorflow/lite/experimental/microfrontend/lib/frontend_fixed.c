@@ -0,0 +1,145 @@
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_fixed.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/bits.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_fixed_tables.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/trace.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/window_ring.h"
+
+#define kFrontendFixedAlignment 64
+
+static size_t FixedAlign(size_t size) {
+  return (size + kFrontendFixedAlignment - 1) &
+         ~(size_t)(kFrontendFixedAlignment - 1);
+}
+
+int FrontendFixedPopulateState(struct FrontendState* state) {
+  memset(state, 0, sizeof(*state));
+
+  const size_t window_bytes = kFrontendFixedWindowSize * sizeof(int16_t);
+  const size_t fft_input_bytes = kFrontendFixedFftSize * sizeof(int16_t);
+  const size_t fft_output_bytes =
+      (kFrontendFixedFftSize / 2 + 1) * sizeof(struct complex_int16_t) * 2;
+  const size_t work_bytes = (kFrontendFixedNumChannels + 1) * sizeof(uint64_t);
+  const size_t estimate_bytes = kFrontendFixedNumChannels * sizeof(uint32_t);
+  const size_t scratch_size = FftScratchSize(kFrontendFixedFftSize);
+  const size_t arena_size = FixedAlign(window_bytes) * 2 +
+                            FixedAlign(fft_input_bytes) +
+                            FixedAlign(fft_output_bytes) +
+                            FixedAlign(work_bytes) +
+                            FixedAlign(estimate_bytes) + FixedAlign(scratch_size);
+
+  void* arena = NULL;
+  if (posix_memalign(&arena, kFrontendFixedAlignment, arena_size) != 0) {
+    fprintf(stderr, "Failed to allocate fixed frontend arena\n");
+    return 0;
+  }
+  memset(arena, 0, arena_size);
+  char* cursor = arena;
+
+  state->window.size = kFrontendFixedWindowSize;
+  state->window.step = kFrontendFixedWindowStep;
+  state->window.coefficients = (int16_t*)kFrontendFixedWindowCoefficients;
+  state->window.input = (int16_t*)cursor;
+  cursor += FixedAlign(window_bytes);
+  state->window.output = (int16_t*)cursor;
+  cursor += FixedAlign(window_bytes);
+
+  state->fft.input_size = kFrontendFixedWindowSize;
+  state->fft.fft_size = kFrontendFixedFftSize;
+  state->fft.input = (int16_t*)cursor;
+  cursor += FixedAlign(fft_input_bytes);
+  state->fft.output = (struct complex_int16_t*)cursor;
+  cursor += FixedAlign(fft_output_bytes);
+
+  state->filterbank.num_channels = kFrontendFixedNumChannels;
+  state->filterbank.start_index = kFrontendFixedStartIndex;
+  state->filterbank.end_index = kFrontendFixedEndIndex;
+  state->filterbank.channel_frequency_starts =
+      (int16_t*)kFrontendFixedChannelFrequencyStarts;
+  state->filterbank.channel_weight_starts =
+      (int16_t*)kFrontendFixedChannelWeightStarts;
+  state->filterbank.channel_widths = (int16_t*)kFrontendFixedChannelWidths;
+  state->filterbank.weights = (int16_t*)kFrontendFixedWeights;
+  state->filterbank.unweights = (int16_t*)kFrontendFixedUnweights;
+  state->filterbank.work = (uint64_t*)cursor;
+  cursor += FixedAlign(work_bytes);
+
+  state->noise_reduction.smoothing_bits = kFrontendFixedSmoothingBits;
+  state->noise_reduction.even_smoothing = kFrontendFixedEvenSmoothing;
+  state->noise_reduction.odd_smoothing = kFrontendFixedOddSmoothing;
+  state->noise_reduction.min_signal_remaining =
+      kFrontendFixedMinSignalRemaining;
+  state->noise_reduction.num_channels = kFrontendFixedNumChannels;
+  state->noise_reduction.estimate = (uint32_t*)cursor;
+  cursor += FixedAlign(estimate_bytes);
+
+  state->pcan_gain_control.enable_pcan = 1;
+  state->pcan_gain_control.noise_estimate = state->noise_reduction.estimate;
+  state->pcan_gain_control.num_channels = kFrontendFixedNumChannels;
+  state->pcan_gain_control.gain_lut = (int16_t*)kFrontendFixedGainLut;
+  state->pcan_gain_control.snr_shift = kFrontendFixedSnrShift;
+
+  state->log_scale.enable_log = 1;
+  state->log_scale.scale_shift = kFrontendFixedLogScaleShift;
+
+  state->fft.scratch_size = scratch_size;
+  if (!FftInitScratch(&state->fft, cursor)) {
+    free(arena);
+    memset(state, 0, sizeof(*state));
+    return 0;
+  }
+
+  state->arena = arena;
+  state->arena_size = arena_size;
+  FrontendSetKernels(state, FrontendKernelsSelect());
+  FrontendReset(state);
+  return 1;
+}
+
+struct FrontendOutput FrontendFixedProcessSamples(struct FrontendState* state,
+                                                  const int16_t* samples,
+                                                  size_t num_samples,
+                                                  size_t* num_samples_read) {
+  struct FrontendOutput output;
+  output.values = NULL;
+  output.size = 0;
+
+  TRACE_BEGIN("frontend.window");
+  const int windowed = WindowRingProcessSamples(
+      &state->window, kFrontendFixedWindowCoefficients,
+      kFrontendFixedWindowSize, kFrontendFixedWindowStep, samples,
+      num_samples, num_samples_read);
+  TRACE_END();
+  if (!windowed) {
+    return output;
+  }
+
+  TRACE_BEGIN("frontend.fft");
+  int input_shift =
+      15 - MostSignificantBit32(state->window.max_abs_output_value);
+  FftCompute(&state->fft, state->window.output, input_shift);
+  TRACE_END();
+
+  TRACE_BEGIN("frontend.filterbank");
+  const struct FrontendKernels* kernels = state->kernels;
+  int32_t* energy = (int32_t*)state->fft.output;
+  kernels->filterbank_energy(state->fft.output + kFrontendFixedStartIndex,
+                             energy + kFrontendFixedStartIndex,
+                             kFrontendFixedEndIndex - kFrontendFixedStartIndex);
+  kernels->filterbank_accumulate(&state->filterbank, energy);
+  uint32_t* scaled_filterbank =
+      kernels->filterbank_sqrt(&state->filterbank, input_shift);
+  TRACE_END();
+
+  TRACE_BEGIN("frontend.post_filterbank");
+  output.size = kFrontendFixedNumChannels;
+  output.values = kernels->post_filterbank_apply(
+      &state->noise_reduction, &state->pcan_gain_control, &state->log_scale,
+      kFrontendFixedCorrectionBits, scaled_filterbank);
+  TRACE_END();
+  return output;
+}
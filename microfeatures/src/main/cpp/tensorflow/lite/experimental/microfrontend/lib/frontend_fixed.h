@@ -0,0 +1,30 @@
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FRONTEND_FIXED_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FRONTEND_FIXED_H_
+
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_fixed_util.h"
+
+// Frontend specialized for the configuration in frontend_fixed_util.c. All
+// tables are generated ahead of time into frontend_fixed_tables.h by
+// frontend_fixed_generator.c, so populating the state only allocates the
+// working buffers, and every loop has a compile-time trip count.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Populates state from the fixed tables. The state can be used with both
+// FrontendFixedProcessSamples and FrontendProcessSamples, and is released
+// with FrontendFreeStateContents.
+int FrontendFixedPopulateState(struct FrontendState* state);
+
+struct FrontendOutput FrontendFixedProcessSamples(struct FrontendState* state,
+                                                  const int16_t* samples,
+                                                  size_t num_samples,
+                                                  size_t* num_samples_read);
+
+#ifdef __cplusplus
+}  
+#endif
+
+#endif  
@@ -0,0 +1,112 @@
+#include <stdio.h>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_fixed_util.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/bits.h"
+
+static void WriteTable(FILE* fp, const char* type, const char* name,
+                       const int16_t* values, size_t size) {
+  fprintf(fp, "static const %s %s[%zu] = {", type, name, size);
+  size_t i;
+  for (i = 0; i < size; ++i) {
+    if (i % 12 == 0) {
+      fprintf(fp, "\n   ");
+    }
+    fprintf(fp, " %d,", values[i]);
+  }
+  fprintf(fp, "\n};\n\n");
+}
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr,
+            "%s requires exactly one parameter - the name of the header to "
+            "save\n",
+            argv[0]);
+    return 1;
+  }
+  struct FrontendConfig config;
+  FrontendFixedFillConfig(&config);
+
+  struct FrontendState state;
+  if (!FrontendPopulateState(&config, &state, kFrontendFixedSampleRate)) {
+    fprintf(stderr, "Failed to populate frontend state\n");
+    FrontendFreeStateContents(&state);
+    return 1;
+  }
+
+  FILE* fp = fopen(argv[1], "w");
+  if (!fp) {
+    fprintf(stderr, "Failed to open header '%s' for write\n", argv[1]);
+    FrontendFreeStateContents(&state);
+    return 1;
+  }
+
+  const struct FilterbankState* filterbank = &state.filterbank;
+  const int num_channels_plus_1 = filterbank->num_channels + 1;
+  size_t num_weights = 0;
+  int chan;
+  for (chan = 0; chan < num_channels_plus_1; ++chan) {
+    const size_t end = filterbank->channel_weight_starts[chan] +
+                       filterbank->channel_widths[chan];
+    if (end > num_weights) {
+      num_weights = end;
+    }
+  }
+
+  // Only entries 0 and 1 and the first three of every group of four after
+  // that are ever read; the rest are left uninitialized by the populate step.
+  int16_t gain_lut[kWideDynamicFunctionLUTSize];
+  size_t i;
+  for (i = 0; i < kWideDynamicFunctionLUTSize; ++i) {
+    gain_lut[i] =
+        (i >= 5 && (i & 3) == 1) ? 0 : state.pcan_gain_control.gain_lut[i];
+  }
+
+  fprintf(fp, "// Generated by frontend_fixed_generator.c, do not edit.\n");
+  fprintf(fp, "#ifndef FRONTEND_FIXED_TABLES_H_\n");
+  fprintf(fp, "#define FRONTEND_FIXED_TABLES_H_\n\n");
+  fprintf(fp, "#include <stdint.h>\n\n");
+  fprintf(fp, "#define kFrontendFixedWindowSize %zu\n", state.window.size);
+  fprintf(fp, "#define kFrontendFixedWindowStep %zu\n", state.window.step);
+  fprintf(fp, "#define kFrontendFixedFftSize %zu\n", state.fft.fft_size);
+  fprintf(fp, "#define kFrontendFixedNumChannels %d\n",
+          filterbank->num_channels);
+  fprintf(fp, "#define kFrontendFixedStartIndex %d\n", filterbank->start_index);
+  fprintf(fp, "#define kFrontendFixedEndIndex %d\n", filterbank->end_index);
+  fprintf(fp, "#define kFrontendFixedNumWeights %zu\n", num_weights);
+  fprintf(fp, "#define kFrontendFixedSmoothingBits %d\n",
+          state.noise_reduction.smoothing_bits);
+  fprintf(fp, "#define kFrontendFixedEvenSmoothing %u\n",
+          state.noise_reduction.even_smoothing);
+  fprintf(fp, "#define kFrontendFixedOddSmoothing %u\n",
+          state.noise_reduction.odd_smoothing);
+  fprintf(fp, "#define kFrontendFixedMinSignalRemaining %u\n",
+          state.noise_reduction.min_signal_remaining);
+  fprintf(fp, "#define kFrontendFixedSnrShift %d\n",
+          state.pcan_gain_control.snr_shift);
+  fprintf(fp, "#define kFrontendFixedLogScaleShift %d\n",
+          state.log_scale.scale_shift);
+  fprintf(fp, "#define kFrontendFixedCorrectionBits %d\n\n",
+          MostSignificantBit32(state.fft.fft_size) - 1 - (kFilterbankBits / 2));
+
+  WriteTable(fp, "int16_t", "kFrontendFixedWindowCoefficients",
+             state.window.coefficients, state.window.size);
+  WriteTable(fp, "int16_t", "kFrontendFixedChannelFrequencyStarts",
+             filterbank->channel_frequency_starts, num_channels_plus_1);
+  WriteTable(fp, "int16_t", "kFrontendFixedChannelWeightStarts",
+             filterbank->channel_weight_starts, num_channels_plus_1);
+  WriteTable(fp, "int16_t", "kFrontendFixedChannelWidths",
+             filterbank->channel_widths, num_channels_plus_1);
+  WriteTable(fp, "int16_t", "kFrontendFixedWeights", filterbank->weights,
+             num_weights);
+  WriteTable(fp, "int16_t", "kFrontendFixedUnweights", filterbank->unweights,
+             num_weights);
+  WriteTable(fp, "int16_t", "kFrontendFixedGainLut", gain_lut,
+             kWideDynamicFunctionLUTSize);
+
+  fprintf(fp, "#endif  // FRONTEND_FIXED_TABLES_H_\n");
+  fclose(fp);
+  FrontendFreeStateContents(&state);
+  return 0;
+}
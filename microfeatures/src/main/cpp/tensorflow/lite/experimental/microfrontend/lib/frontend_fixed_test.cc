@@ -0,0 +1,142 @@
+
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_fixed.h"
+
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_util.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace {
+
+const int kNumSamples = kFrontendFixedSampleRate * 2;
+
+// Deterministic mix of a sweeping tone and noise whose level changes every
+// quarter second, so noise reduction and PCAN both move.
+void FillTestAudio(int16_t* audio, int num_samples) {
+  uint32_t seed = 1;
+  for (int i = 0; i < num_samples; ++i) {
+    seed = seed * 1103515245 + 12345;
+    const int32_t noise = (int32_t)((seed >> 16) & 0x7FFF) - 16384;
+    const int32_t level = 1 + (i / (kFrontendFixedSampleRate / 4)) % 4;
+    int32_t value = noise * level / 8 + (i % 97) * 200 - 9600;
+    if (value > 32767) value = 32767;
+    if (value < -32768) value = -32768;
+    audio[i] = (int16_t)value;
+  }
+}
+
+}
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(FrontendFixedTest_MatchesConfig) {
+  struct FrontendConfig config;
+  FrontendFixedFillConfig(&config);
+  TF_LITE_MICRO_EXPECT(
+      FrontendFixedMatchesConfig(&config, kFrontendFixedSampleRate));
+  TF_LITE_MICRO_EXPECT(!FrontendFixedMatchesConfig(&config, 8000));
+
+  config.filterbank.num_channels = 32;
+  TF_LITE_MICRO_EXPECT(
+      !FrontendFixedMatchesConfig(&config, kFrontendFixedSampleRate));
+}
+
+TF_LITE_MICRO_TEST(FrontendFixedTest_MatchesDynamicFrontend) {
+  struct FrontendConfig config;
+  FrontendFixedFillConfig(&config);
+  struct FrontendState dynamic_state;
+  TF_LITE_MICRO_EXPECT(FrontendPopulateState(&config, &dynamic_state,
+                                             kFrontendFixedSampleRate));
+  struct FrontendState fixed_state;
+  TF_LITE_MICRO_EXPECT(FrontendFixedPopulateState(&fixed_state));
+
+  static int16_t audio[kNumSamples];
+  FillTestAudio(audio, kNumSamples);
+
+  size_t dynamic_position = 0;
+  size_t fixed_position = 0;
+  int frames = 0;
+  while (dynamic_position < kNumSamples) {
+    size_t dynamic_read;
+    size_t fixed_read;
+    struct FrontendOutput dynamic_output = FrontendProcessSamples(
+        &dynamic_state, audio + dynamic_position,
+        kNumSamples - dynamic_position, &dynamic_read);
+    struct FrontendOutput fixed_output = FrontendFixedProcessSamples(
+        &fixed_state, audio + fixed_position, kNumSamples - fixed_position,
+        &fixed_read);
+    dynamic_position += dynamic_read;
+    fixed_position += fixed_read;
+
+    TF_LITE_MICRO_EXPECT_EQ(dynamic_read, fixed_read);
+    TF_LITE_MICRO_EXPECT_EQ(dynamic_output.size, fixed_output.size);
+    for (size_t i = 0; i < dynamic_output.size; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(dynamic_output.values[i],
+                              fixed_output.values[i]);
+    }
+    if (fixed_output.size > 0) {
+      ++frames;
+    }
+  }
+  TF_LITE_MICRO_EXPECT_EQ(
+      frames, (kNumSamples - kFrontendFixedSampleRate * 30 / 1000) /
+                      (kFrontendFixedSampleRate * 10 / 1000) +
+                  1);
+
+  FrontendFreeStateContents(&dynamic_state);
+  FrontendFreeStateContents(&fixed_state);
+}
+
+TF_LITE_MICRO_TEST(FrontendFixedTest_StateMovesBetweenFrontends) {
+  struct FrontendConfig config;
+  FrontendFixedFillConfig(&config);
+  struct FrontendState dynamic_state;
+  TF_LITE_MICRO_EXPECT(FrontendPopulateState(&config, &dynamic_state,
+                                             kFrontendFixedSampleRate));
+  struct FrontendState fixed_state;
+  TF_LITE_MICRO_EXPECT(FrontendFixedPopulateState(&fixed_state));
+
+  static int16_t audio[kNumSamples];
+  FillTestAudio(audio, kNumSamples);
+
+  // Leaves part of a window pending in the dynamic state before the move.
+  const size_t split = kNumSamples / 2 + 101;
+  size_t position = 0;
+  while (position < split) {
+    size_t num_samples_read;
+    FrontendProcessSamples(&dynamic_state, audio + position, split - position,
+                           &num_samples_read);
+    position += num_samples_read;
+  }
+  static uint8_t blob[4096];
+  const size_t size = FrontendSaveState(&dynamic_state, blob, sizeof(blob));
+  TF_LITE_MICRO_EXPECT_EQ(size, FrontendSaveStateSize(&dynamic_state));
+  TF_LITE_MICRO_EXPECT(FrontendRestoreState(&fixed_state, blob, size));
+
+  int frames = 0;
+  while (position < kNumSamples) {
+    size_t dynamic_read;
+    size_t fixed_read;
+    struct FrontendOutput dynamic_output = FrontendProcessSamples(
+        &dynamic_state, audio + position, kNumSamples - position,
+        &dynamic_read);
+    struct FrontendOutput fixed_output = FrontendFixedProcessSamples(
+        &fixed_state, audio + position, kNumSamples - position, &fixed_read);
+    position += dynamic_read;
+
+    TF_LITE_MICRO_EXPECT_EQ(dynamic_read, fixed_read);
+    TF_LITE_MICRO_EXPECT_EQ(dynamic_output.size, fixed_output.size);
+    for (size_t i = 0; i < dynamic_output.size; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(dynamic_output.values[i],
+                              fixed_output.values[i]);
+    }
+    if (fixed_output.size > 0) {
+      ++frames;
+    }
+  }
+  TF_LITE_MICRO_EXPECT_GT(frames, 0);
+
+  FrontendFreeStateContents(&dynamic_state);
+  FrontendFreeStateContents(&fixed_state);
+}
+
+TF_LITE_MICRO_TESTS_END
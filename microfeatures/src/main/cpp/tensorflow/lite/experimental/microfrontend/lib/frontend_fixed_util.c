@@ -0,0 +1,51 @@
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_fixed_util.h"
+
+void FrontendFixedFillConfig(struct FrontendConfig* config) {
+  config->window.size_ms = 30;
+  config->window.step_size_ms = 10;
+  config->filterbank.num_channels = 40;
+  config->filterbank.lower_band_limit = 125.0;
+  config->filterbank.upper_band_limit = 7500.0;
+  config->filterbank.output_scale_shift = 7;
+  config->noise_reduction.smoothing_bits = 10;
+  config->noise_reduction.even_smoothing = 0.025;
+  config->noise_reduction.odd_smoothing = 0.06;
+  config->noise_reduction.min_signal_remaining = 0.05;
+  config->pcan_gain_control.enable_pcan = 1;
+  config->pcan_gain_control.strength = 0.95;
+  config->pcan_gain_control.offset = 80.0;
+  config->pcan_gain_control.gain_bits = 21;
+  config->log_scale.enable_log = 1;
+  config->log_scale.scale_shift = 6;
+}
+
+int FrontendFixedMatchesConfig(const struct FrontendConfig* config,
+                               int sample_rate) {
+  struct FrontendConfig fixed;
+  FrontendFixedFillConfig(&fixed);
+  return sample_rate == kFrontendFixedSampleRate &&
+         config->window.size_ms == fixed.window.size_ms &&
+         config->window.step_size_ms == fixed.window.step_size_ms &&
+         config->filterbank.num_channels == fixed.filterbank.num_channels &&
+         config->filterbank.lower_band_limit ==
+             fixed.filterbank.lower_band_limit &&
+         config->filterbank.upper_band_limit ==
+             fixed.filterbank.upper_band_limit &&
+         config->noise_reduction.smoothing_bits ==
+             fixed.noise_reduction.smoothing_bits &&
+         config->noise_reduction.even_smoothing ==
+             fixed.noise_reduction.even_smoothing &&
+         config->noise_reduction.odd_smoothing ==
+             fixed.noise_reduction.odd_smoothing &&
+         config->noise_reduction.min_signal_remaining ==
+             fixed.noise_reduction.min_signal_remaining &&
+         config->pcan_gain_control.enable_pcan ==
+             fixed.pcan_gain_control.enable_pcan &&
+         config->pcan_gain_control.strength ==
+             fixed.pcan_gain_control.strength &&
+         config->pcan_gain_control.offset == fixed.pcan_gain_control.offset &&
+         config->pcan_gain_control.gain_bits ==
+             fixed.pcan_gain_control.gain_bits &&
+         config->log_scale.enable_log == fixed.log_scale.enable_log &&
+         config->log_scale.scale_shift == fixed.log_scale.scale_shift;
+}
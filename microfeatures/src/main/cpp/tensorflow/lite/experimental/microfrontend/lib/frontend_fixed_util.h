@@ -0,0 +1,25 @@
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FRONTEND_FIXED_UTIL_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FRONTEND_FIXED_UTIL_H_
+
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_util.h"
+
+#define kFrontendFixedSampleRate 16000
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The microWakeWord feature configuration: 16 kHz audio, 30 ms windows every
+// 10 ms, 40 channels from 125 to 7500 Hz, with PCAN and log scaling.
+void FrontendFixedFillConfig(struct FrontendConfig* config);
+
+// Returns 1 if config at sample_rate is the configuration the fixed tables
+// were generated for.
+int FrontendFixedMatchesConfig(const struct FrontendConfig* config,
+                               int sample_rate);
+
+#ifdef __cplusplus
+}  
+#endif
+
+#endif  
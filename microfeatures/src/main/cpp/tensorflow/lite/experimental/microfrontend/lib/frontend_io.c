@@ -47,6 +47,7 @@ int WriteFrontendStateMemmap(const char* header, const char* source,
   NoiseReductionWriteMemmap(fp, &state->noise_reduction,
                             "  (&state.noise_reduction)");
   LogScaleWriteMemmap(fp, &state->log_scale, "  (&state.log_scale)");
+  fprintf(fp, "  FrontendSetKernels(&state, FrontendKernelsSelect());\n");
   fprintf(fp, "  FftInit(&state.fft);\n");
   fprintf(fp, "  FrontendReset(&state);\n");
   fprintf(fp, "  return &state;\n");
@@ -0,0 +1,39 @@
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
+
+// Slowest first.
+static const struct FrontendKernels* const kFrontendKernelsVariants[] = {
+    &kFrontendKernelsScalar,
+#if defined(FRONTEND_KERNELS_HAVE_NEON)
+    &kFrontendKernelsNeon,
+#endif
+#if defined(FRONTEND_KERNELS_HAVE_SSE4_1)
+    &kFrontendKernelsSse4_1,
+#endif
+};
+
+int FrontendKernelsCount(void) {
+  return sizeof(kFrontendKernelsVariants) / sizeof(kFrontendKernelsVariants[0]);
+}
+
+const struct FrontendKernels* FrontendKernelsVariant(int index) {
+  return kFrontendKernelsVariants[index];
+}
+
+int FrontendKernelsSupported(const struct FrontendKernels* kernels) {
+  return (kernels->required_features & ~CpuFeaturesDetect()) == 0;
+}
+
+const struct FrontendKernels* FrontendKernelsForFeatures(int features) {
+  int i;
+  for (i = FrontendKernelsCount() - 1; i > 0; --i) {
+    const struct FrontendKernels* kernels = kFrontendKernelsVariants[i];
+    if ((kernels->required_features & ~features) == 0) {
+      return kernels;
+    }
+  }
+  return &kFrontendKernelsScalar;
+}
+
+const struct FrontendKernels* FrontendKernelsSelect(void) {
+  return FrontendKernelsForFeatures(CpuFeaturesDetect());
+}
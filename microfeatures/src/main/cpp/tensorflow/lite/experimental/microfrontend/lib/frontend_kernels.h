@@ -0,0 +1,83 @@
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FRONTEND_KERNELS_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FRONTEND_KERNELS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/cpu_features.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/fft.h"
+
+// The variants built for the target architecture besides the portable one.
+// Each is compiled in its own frontend_kernels_*.c with the instruction set
+// enabled for that file only, so the rest of the library runs on CPUs
+// without it.
+#if defined(__aarch64__) || defined(__arm__)
+#define FRONTEND_KERNELS_HAVE_NEON 1
+#elif defined(__x86_64__) || defined(__i386__)
+#define FRONTEND_KERNELS_HAVE_SSE4_1 1
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct FilterbankState;
+struct LogScaleState;
+struct NoiseReductionState;
+struct PcanGainControlState;
+
+// The hot loops of the frontend for one instruction set. All variants give
+// bit-identical results; they are chosen once, when a state is populated.
+struct FrontendKernels {
+  // "scalar", "neon" or "sse4.1".
+  const char* name;
+  // kCpuFeature bits the CPU must have to run these kernels.
+  int required_features;
+
+  int16_t (*window_apply)(const int16_t* input, const int16_t* coefficients,
+                          int16_t* output, int count,
+                          int16_t max_abs_output_value);
+  void (*fft_512)(const int16_t* input, size_t input_size,
+                  int input_scale_shift, struct complex_int16_t* output);
+  void (*filterbank_energy)(const struct complex_int16_t* fft_output,
+                            int32_t* energy, int count);
+  void (*filterbank_accumulate)(struct FilterbankState* state,
+                                const int32_t* energy);
+  uint32_t* (*filterbank_sqrt)(struct FilterbankState* state,
+                               int scale_down_shift);
+  uint16_t* (*post_filterbank_apply)(
+      struct NoiseReductionState* noise_reduction,
+      const struct PcanGainControlState* pcan_gain_control,
+      const struct LogScaleState* log_scale, int correction_bits,
+      uint32_t* signal);
+};
+
+extern const struct FrontendKernels kFrontendKernelsScalar;
+#if defined(FRONTEND_KERNELS_HAVE_NEON)
+extern const struct FrontendKernels kFrontendKernelsNeon;
+#endif
+#if defined(FRONTEND_KERNELS_HAVE_SSE4_1)
+extern const struct FrontendKernels kFrontendKernelsSse4_1;
+#endif
+
+// Number of variants built into the library, for tests and benchmarks that
+// compare them.
+int FrontendKernelsCount(void);
+
+// The variants by index, the scalar one first.
+const struct FrontendKernels* FrontendKernelsVariant(int index);
+
+// Whether the running CPU has the features the variant needs.
+int FrontendKernelsSupported(const struct FrontendKernels* kernels);
+
+// The fastest variant that only needs the given kCpuFeature bits.
+const struct FrontendKernels* FrontendKernelsForFeatures(int features);
+
+// The fastest variant the running CPU supports.
+const struct FrontendKernels* FrontendKernelsSelect(void);
+
+#ifdef __cplusplus
+}  
+#endif
+
+#endif  
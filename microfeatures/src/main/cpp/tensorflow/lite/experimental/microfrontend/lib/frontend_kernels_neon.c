@@ -0,0 +1,13 @@
+// The NEON kernels. On 32-bit ARM the library is built without NEON and the
+// build enables it for this file only.
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
+
+#if defined(FRONTEND_KERNELS_HAVE_NEON)
+#if !defined(__ARM_NEON) && !defined(__ARM_NEON__)
+#error "frontend_kernels_neon.c must be compiled with NEON enabled"
+#endif
+#define FRONTEND_KERNELS_TABLE kFrontendKernelsNeon
+#define FRONTEND_KERNELS_NAME "neon"
+#define FRONTEND_KERNELS_FEATURES kCpuFeatureNeon
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels_variant.h"
+#endif
@@ -0,0 +1,7 @@
+// The portable kernels, without vector intrinsics even where the compiler
+// targets an instruction set that has them.
+#define FRONTEND_KERNELS_SCALAR 1
+#define FRONTEND_KERNELS_TABLE kFrontendKernelsScalar
+#define FRONTEND_KERNELS_NAME "scalar"
+#define FRONTEND_KERNELS_FEATURES 0
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels_variant.h"
@@ -0,0 +1,13 @@
+// The SSE4.1 kernels. The x86 library only assumes the ABI baseline and the
+// build enables SSE4.1 for this file only.
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
+
+#if defined(FRONTEND_KERNELS_HAVE_SSE4_1)
+#if !defined(__SSE4_1__)
+#error "frontend_kernels_sse4_1.c must be compiled with -msse4.1"
+#endif
+#define FRONTEND_KERNELS_TABLE kFrontendKernelsSse4_1
+#define FRONTEND_KERNELS_NAME "sse4.1"
+#define FRONTEND_KERNELS_FEATURES kCpuFeatureSse4_1
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels_variant.h"
+#endif
@@ -0,0 +1,26 @@
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FRONTEND_KERNELS_VARIANT_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_FRONTEND_KERNELS_VARIANT_H_
+
+// Defines FRONTEND_KERNELS_TABLE, named FRONTEND_KERNELS_NAME and requiring
+// FRONTEND_KERNELS_FEATURES, from the kernel headers as compiled for the
+// instruction set of the including file. Only the frontend_kernels_*.c files
+// include this.
+
+#include "tensorflow/lite/experimental/microfrontend/lib/fft_512_kernels.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/filterbank_kernels.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/post_filterbank_kernels.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/window_kernels.h"
+
+const struct FrontendKernels FRONTEND_KERNELS_TABLE = {
+    FRONTEND_KERNELS_NAME,
+    FRONTEND_KERNELS_FEATURES,
+    WindowApply,
+    Fft512Compute,
+    FilterbankEnergy,
+    FilterbankAccumulate,
+    FilterbankSqrtChannels,
+    PostFilterbankApply,
+};
+
+#endif  
@@ -13,6 +13,8 @@ const int16_t kFakeAudioData[] = {
     0, 32767, 0, -32768, 0, 32767, 0, -32768, 0, 32767, 0, -32768,
     0, 32767, 0, -32768, 0, 32767, 0, -32768, 0, 32767, 0, -32768,
     0, 32767, 0, -32768, 0, 32767, 0, -32768, 0, 32767, 0, -32768};
+const int kPostFilterbankChannels = 11;
+const int kPostFilterbankFrames = 2000;
 
 
 class FrontendTestConfig {
@@ -39,6 +41,68 @@ class FrontendTestConfig {
   struct FrontendConfig config_;
 };
 
+uint32_t NextRandom(uint32_t* seed) {
+  *seed = *seed * 1103515245 + 12345;
+  return *seed;
+}
+
+// Runs the fused post-filterbank kernel and the separate noise reduction, PCAN
+// and log scale stages side by side on signals spanning the whole uint32_t
+// range.
+void CheckPostFilterbankMatchesStages(const struct FrontendKernels* kernels,
+                                      int correction_bits) {
+  FrontendTestConfig config;
+  struct NoiseReductionState stages_noise_reduction;
+  struct NoiseReductionState fused_noise_reduction;
+  TF_LITE_MICRO_EXPECT(NoiseReductionPopulateState(
+      &config.config_.noise_reduction, &stages_noise_reduction,
+      kPostFilterbankChannels));
+  TF_LITE_MICRO_EXPECT(NoiseReductionPopulateState(
+      &config.config_.noise_reduction, &fused_noise_reduction,
+      kPostFilterbankChannels));
+  struct PcanGainControlState stages_pcan;
+  struct PcanGainControlState fused_pcan;
+  TF_LITE_MICRO_EXPECT(PcanGainControlPopulateState(
+      &config.config_.pcan_gain_control, &stages_pcan,
+      stages_noise_reduction.estimate, kPostFilterbankChannels,
+      stages_noise_reduction.smoothing_bits, correction_bits));
+  TF_LITE_MICRO_EXPECT(PcanGainControlPopulateState(
+      &config.config_.pcan_gain_control, &fused_pcan,
+      fused_noise_reduction.estimate, kPostFilterbankChannels,
+      fused_noise_reduction.smoothing_bits, correction_bits));
+  struct LogScaleState log_scale;
+  TF_LITE_MICRO_EXPECT(
+      LogScalePopulateState(&config.config_.log_scale, &log_scale));
+
+  uint32_t seed = 1;
+  for (int frame = 0; frame < kPostFilterbankFrames; ++frame) {
+    uint32_t stages_signal[kPostFilterbankChannels];
+    uint32_t fused_signal[kPostFilterbankChannels];
+    for (int i = 0; i < kPostFilterbankChannels; ++i) {
+      const uint32_t random = NextRandom(&seed);
+      stages_signal[i] = frame < 4 ? frame : random >> (random % 32);
+      fused_signal[i] = stages_signal[i];
+    }
+    NoiseReductionApply(&stages_noise_reduction, stages_signal);
+    PcanGainControlApply(&stages_pcan, stages_signal);
+    const uint16_t* expected = LogScaleApply(
+        &log_scale, stages_signal, kPostFilterbankChannels, correction_bits);
+    const uint16_t* actual = kernels->post_filterbank_apply(
+        &fused_noise_reduction, &fused_pcan, &log_scale, correction_bits,
+        fused_signal);
+    for (int i = 0; i < kPostFilterbankChannels; ++i) {
+      TF_LITE_MICRO_EXPECT_EQ(actual[i], expected[i]);
+      TF_LITE_MICRO_EXPECT_EQ(fused_noise_reduction.estimate[i],
+                              stages_noise_reduction.estimate[i]);
+    }
+  }
+
+  NoiseReductionFreeStateContents(&stages_noise_reduction);
+  NoiseReductionFreeStateContents(&fused_noise_reduction);
+  PcanGainControlFreeStateContents(&stages_pcan);
+  PcanGainControlFreeStateContents(&fused_pcan);
+}
+
 }  
 
 TF_LITE_MICRO_TESTS_BEGIN
@@ -113,4 +177,15 @@ TF_LITE_MICRO_TEST(FrontendTest_CheckNotEnoughSamples) {
   FrontendFreeStateContents(&state);
 }
 
+TF_LITE_MICRO_TEST(FrontendTest_PostFilterbankMatchesStages) {
+  for (int variant = 0; variant < FrontendKernelsCount(); ++variant) {
+    const struct FrontendKernels* kernels = FrontendKernelsVariant(variant);
+    if (!FrontendKernelsSupported(kernels)) {
+      continue;
+    }
+    CheckPostFilterbankMatchesStages(kernels, 3);
+    CheckPostFilterbankMatchesStages(kernels, -1);
+  }
+}
+
 TF_LITE_MICRO_TESTS_END
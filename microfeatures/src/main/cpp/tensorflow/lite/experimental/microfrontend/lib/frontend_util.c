@@ -2,10 +2,124 @@
 #include "tensorflow/lite/experimental/microfrontend/lib/frontend_util.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "tensorflow/lite/experimental/microfrontend/lib/bits.h"
 
+#define kFrontendArenaAlignment 64
+
+static size_t ArenaAlign(size_t size) {
+  return (size + kFrontendArenaAlignment - 1) &
+         ~(size_t)(kFrontendArenaAlignment - 1);
+}
+
+static void* ArenaTake(char** cursor, const void* src, size_t size) {
+  void* dst = *cursor;
+  if (src != NULL) {
+    memcpy(dst, src, size);
+  }
+  *cursor += ArenaAlign(size);
+  return dst;
+}
+
+static size_t FilterbankNumWeights(const struct FilterbankState* state) {
+  size_t num_weights = 0;
+  int chan;
+  for (chan = 0; chan <= state->num_channels; ++chan) {
+    const size_t end =
+        state->channel_weight_starts[chan] + state->channel_widths[chan];
+    if (end > num_weights) {
+      num_weights = end;
+    }
+  }
+  return num_weights;
+}
+
+// Moves every buffer of a populated state into one cache-aligned block. The
+// buffers touched on every frame come first so they share as few cache lines
+// as possible; the read-only tables follow. On failure the state keeps its
+// separate allocations and stays usable, and arena_size is set to their
+// total so the memory is still accounted for.
+static int FrontendCompactState(struct FrontendState* state) {
+  const size_t window_bytes = state->window.size * sizeof(int16_t);
+  const size_t fft_input_bytes = state->fft.fft_size * sizeof(int16_t);
+  const size_t fft_output_bytes = (state->fft.fft_size / 2 + 1) *
+                                  sizeof(struct complex_int16_t) * 2;
+  const size_t num_channels_plus_1 = state->filterbank.num_channels + 1;
+  const size_t channel_bytes = num_channels_plus_1 * sizeof(int16_t);
+  const size_t work_bytes = num_channels_plus_1 * sizeof(uint64_t);
+  const size_t estimate_bytes =
+      state->noise_reduction.num_channels * sizeof(uint32_t);
+  const size_t weight_bytes =
+      FilterbankNumWeights(&state->filterbank) * sizeof(int16_t);
+  const size_t gain_lut_bytes =
+      state->pcan_gain_control.enable_pcan
+          ? kWideDynamicFunctionLUTSize * sizeof(int16_t)
+          : 0;
+
+  const size_t separate_size =
+      window_bytes * 3 + fft_input_bytes + fft_output_bytes + work_bytes +
+      estimate_bytes + channel_bytes * 3 + weight_bytes * 2 + gain_lut_bytes +
+      state->fft.scratch_size;
+  const size_t arena_size =
+      ArenaAlign(window_bytes) * 3 + ArenaAlign(fft_input_bytes) +
+      ArenaAlign(fft_output_bytes) + ArenaAlign(work_bytes) +
+      ArenaAlign(estimate_bytes) + ArenaAlign(channel_bytes) * 3 +
+      ArenaAlign(weight_bytes) * 2 + ArenaAlign(gain_lut_bytes) +
+      ArenaAlign(state->fft.scratch_size);
+
+  void* arena = NULL;
+  if (posix_memalign(&arena, kFrontendArenaAlignment, arena_size) != 0) {
+    fprintf(stderr, "Failed to allocate frontend arena\n");
+    state->arena_size = separate_size;
+    return 0;
+  }
+  memset(arena, 0, arena_size);
+
+  struct FrontendState old = *state;
+  char* cursor = arena;
+
+  state->window.input = ArenaTake(&cursor, old.window.input, window_bytes);
+  state->window.output = ArenaTake(&cursor, old.window.output, window_bytes);
+  state->fft.input = ArenaTake(&cursor, old.fft.input, fft_input_bytes);
+  state->fft.output = ArenaTake(&cursor, old.fft.output, fft_output_bytes);
+  state->filterbank.work = ArenaTake(&cursor, old.filterbank.work, work_bytes);
+  state->noise_reduction.estimate =
+      ArenaTake(&cursor, old.noise_reduction.estimate, estimate_bytes);
+
+  state->window.coefficients =
+      ArenaTake(&cursor, old.window.coefficients, window_bytes);
+  state->filterbank.channel_frequency_starts = ArenaTake(
+      &cursor, old.filterbank.channel_frequency_starts, channel_bytes);
+  state->filterbank.channel_weight_starts =
+      ArenaTake(&cursor, old.filterbank.channel_weight_starts, channel_bytes);
+  state->filterbank.channel_widths =
+      ArenaTake(&cursor, old.filterbank.channel_widths, channel_bytes);
+  state->filterbank.weights =
+      ArenaTake(&cursor, old.filterbank.weights, weight_bytes);
+  state->filterbank.unweights =
+      ArenaTake(&cursor, old.filterbank.unweights, weight_bytes);
+  if (gain_lut_bytes > 0) {
+    state->pcan_gain_control.gain_lut =
+        ArenaTake(&cursor, old.pcan_gain_control.gain_lut, gain_lut_bytes);
+    state->pcan_gain_control.noise_estimate = state->noise_reduction.estimate;
+  }
+
+  if (!FftInitScratch(&state->fft, cursor)) {
+    *state = old;
+    free(arena);
+    state->arena_size = separate_size;
+    return 0;
+  }
+
+  old.arena = NULL;
+  FrontendFreeStateContents(&old);
+  state->arena = arena;
+  state->arena_size = arena_size;
+  return 1;
+}
+
 void FrontendFillConfigWithDefaults(struct FrontendConfig* config) {
   WindowFillConfigWithDefaults(&config->window);
   FilterbankFillConfigWithDefaults(&config->filterbank);
@@ -57,6 +171,8 @@ int FrontendPopulateState(const struct FrontendConfig* config,
     return 0;
   }
 
+  FrontendSetKernels(state, FrontendKernelsSelect());
+  FrontendCompactState(state);
   FrontendReset(state);
 
   
@@ -64,9 +180,16 @@ int FrontendPopulateState(const struct FrontendConfig* config,
 }
 
 void FrontendFreeStateContents(struct FrontendState* state) {
+  if (state->arena != NULL) {
+    free(state->arena);
+    state->arena = NULL;
+    state->arena_size = 0;
+    return;
+  }
   WindowFreeStateContents(&state->window);
   FftFreeStateContents(&state->fft);
   FilterbankFreeStateContents(&state->filterbank);
   NoiseReductionFreeStateContents(&state->noise_reduction);
   PcanGainControlFreeStateContents(&state->pcan_gain_control);
+  state->arena_size = 0;
 }
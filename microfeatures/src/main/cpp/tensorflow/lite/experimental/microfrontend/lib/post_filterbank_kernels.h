@@ -0,0 +1,260 @@
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_POST_FILTERBANK_KERNELS_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_POST_FILTERBANK_KERNELS_H_
+
+#include <stdint.h>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/log_lut.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/log_scale.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/noise_reduction.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/pcan_gain_control.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/bits.h"
+
+#if defined(FRONTEND_KERNELS_SCALAR)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define POST_FILTERBANK_KERNELS_NEON 1
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define POST_FILTERBANK_KERNELS_SSE4_1 1
+#endif
+
+// NoiseReductionApply, PcanGainControlApply and LogScaleApply fused into a
+// single pass over the channels, bit-identical to running the three in turn.
+//
+// The data-dependent shifts of WideDynamicFunction and Log2FractionPart are
+// replaced by normalizing the value so its top bit is set, after which the
+// fraction is a fixed bit field, and the 64-bit product in Log is split into
+// integer and fraction parts that both fit in 32 bits. Noise reduction is
+// vectorized four channels at a time; gain and log stay per lane, since
+// their table lookups cost more as vector gathers than they save.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define kPostFilterbankLogFractionBits (kLogScaleLog2 - kLogSegmentsLog2)
+
+static inline int16_t PostFilterbankGain(uint32_t x, const int16_t* lut) {
+  if (x <= 2) {
+    return lut[x];
+  }
+  const int shift = CountLeadingZeros32(x);
+  lut += 4 * (32 - shift) - 6;
+  const int32_t frac = ((x << shift) >> 21) & 0x3FF;
+
+  int32_t result = ((int32_t)lut[2] * frac) >> 5;
+  result += (int32_t)((uint32_t)lut[1] << 5);
+  result *= frac;
+  result = (result + (1 << 14)) >> 15;
+  result += lut[0];
+  return (int16_t)result;
+}
+
+static inline uint32_t PostFilterbankShrink(uint32_t x) {
+  if (x < (2 << kPcanSnrBits)) {
+    return (x * x) >> (2 + 2 * kPcanSnrBits - kPcanOutputBits);
+  }
+  return (x >> (kPcanSnrBits - kPcanOutputBits)) - (1 << kPcanOutputBits);
+}
+
+// Log of x > 1, as computed by log_scale.c.
+static inline uint32_t PostFilterbankLog(uint32_t x, int scale_shift) {
+  const int shift = CountLeadingZeros32(x);
+  const uint32_t integer = 31 - shift;
+  const uint32_t frac = ((x << shift) << 1) >> (32 - kLogScaleLog2);
+  const uint32_t base_seg = frac >> kPostFilterbankLogFractionBits;
+  const int32_t c0 = kLogLut[base_seg];
+  const int32_t c1 = kLogLut[base_seg + 1];
+  const int32_t rel_pos =
+      ((c1 - c0) *
+       (int32_t)(frac - (base_seg << kPostFilterbankLogFractionBits))) >>
+      kLogScaleLog2;
+  const uint32_t fraction = frac + c0 + rel_pos;
+  const uint32_t loge =
+      kLogCoeff * integer +
+      ((kLogCoeff * fraction + kLogScale / 2) >> kLogScaleLog2);
+  return ((loge << scale_shift) + kLogScale / 2) >> kLogScaleLog2;
+}
+
+// PCAN and log scaling of one noise reduced channel.
+static inline uint16_t PostFilterbankFinish(
+    const struct PcanGainControlState* pcan_gain_control, int scale_shift,
+    int correction_bits, uint32_t estimate, uint32_t reduced) {
+  const uint32_t gain =
+      PostFilterbankGain(estimate, pcan_gain_control->gain_lut);
+  uint32_t value = PostFilterbankShrink(
+      ((uint64_t)reduced * gain) >> pcan_gain_control->snr_shift);
+
+  if (correction_bits < 0) {
+    value >>= -correction_bits;
+  } else {
+    value <<= correction_bits;
+  }
+  value = value > 1 ? PostFilterbankLog(value, scale_shift) : 0;
+  return value < 0xFFFF ? value : 0xFFFF;
+}
+
+static inline uint16_t PostFilterbankChannel(
+    struct NoiseReductionState* noise_reduction,
+    const struct PcanGainControlState* pcan_gain_control, int scale_shift,
+    int correction_bits, int channel, uint32_t signal) {
+  const uint32_t smoothing = ((channel & 1) == 0)
+                                 ? noise_reduction->even_smoothing
+                                 : noise_reduction->odd_smoothing;
+  const uint32_t one_minus_smoothing = (1 << kNoiseReductionBits) - smoothing;
+  const int smoothing_bits = noise_reduction->smoothing_bits;
+
+  const uint32_t signal_scaled_up = signal << smoothing_bits;
+  const uint32_t estimate =
+      (((uint64_t)signal_scaled_up * smoothing) +
+       ((uint64_t)noise_reduction->estimate[channel] * one_minus_smoothing)) >>
+      kNoiseReductionBits;
+  noise_reduction->estimate[channel] = estimate;
+  const uint32_t clamped =
+      estimate < signal_scaled_up ? estimate : signal_scaled_up;
+  const uint32_t floor =
+      ((uint64_t)signal * noise_reduction->min_signal_remaining) >>
+      kNoiseReductionBits;
+  const uint32_t subtracted = (signal_scaled_up - clamped) >> smoothing_bits;
+  return PostFilterbankFinish(pcan_gain_control, scale_shift, correction_bits,
+                              estimate,
+                              subtracted > floor ? subtracted : floor);
+}
+
+#if defined(POST_FILTERBANK_KERNELS_NEON)
+
+// Noise reduction of the four channels starting at an even channel. Updates
+// their estimates and returns the reduced signal.
+static inline void PostFilterbankNoiseReduction(
+    struct NoiseReductionState* noise_reduction, int channel,
+    const uint32_t* input, uint32_t* reduced) {
+  const uint32x4_t signal = vld1q_u32(input);
+  uint32_t* estimate_pointer = noise_reduction->estimate + channel;
+  const uint32x4_t previous_estimate = vld1q_u32(estimate_pointer);
+
+  const uint32x2_t smoothing = vset_lane_u32(
+      noise_reduction->odd_smoothing,
+      vdup_n_u32(noise_reduction->even_smoothing), 1);
+  const uint32x2_t one_minus_smoothing =
+      vsub_u32(vdup_n_u32(1 << kNoiseReductionBits), smoothing);
+  const int32x4_t smoothing_bits = vdupq_n_s32(noise_reduction->smoothing_bits);
+  const uint32x4_t signal_scaled_up = vshlq_u32(signal, smoothing_bits);
+  const uint64x2_t estimate_low = vmlal_u32(
+      vmull_u32(vget_low_u32(signal_scaled_up), smoothing),
+      vget_low_u32(previous_estimate), one_minus_smoothing);
+  const uint64x2_t estimate_high = vmlal_u32(
+      vmull_u32(vget_high_u32(signal_scaled_up), smoothing),
+      vget_high_u32(previous_estimate), one_minus_smoothing);
+  const uint32x4_t estimate =
+      vcombine_u32(vshrn_n_u64(estimate_low, kNoiseReductionBits),
+                   vshrn_n_u64(estimate_high, kNoiseReductionBits));
+  vst1q_u32(estimate_pointer, estimate);
+
+  const uint32x2_t min_signal_remaining =
+      vdup_n_u32(noise_reduction->min_signal_remaining);
+  const uint32x4_t floor = vcombine_u32(
+      vshrn_n_u64(vmull_u32(vget_low_u32(signal), min_signal_remaining),
+                  kNoiseReductionBits),
+      vshrn_n_u64(vmull_u32(vget_high_u32(signal), min_signal_remaining),
+                  kNoiseReductionBits));
+  const uint32x4_t subtracted =
+      vshlq_u32(vsubq_u32(signal_scaled_up,
+                          vminq_u32(estimate, signal_scaled_up)),
+                vnegq_s32(smoothing_bits));
+  vst1q_u32(reduced, vmaxq_u32(subtracted, floor));
+}
+
+#elif defined(POST_FILTERBANK_KERNELS_SSE4_1)
+
+// Low 32 bits of (a * b + c * d) >> shift with 64-bit products.
+static inline __m128i PostFilterbankMulAddShift(__m128i a, __m128i b,
+                                                __m128i c, __m128i d,
+                                                __m128i shift) {
+  const __m128i even = _mm_srl_epi64(
+      _mm_add_epi64(_mm_mul_epu32(a, b), _mm_mul_epu32(c, d)), shift);
+  const __m128i odd = _mm_srl_epi64(
+      _mm_add_epi64(
+          _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)),
+          _mm_mul_epu32(_mm_srli_epi64(c, 32), _mm_srli_epi64(d, 32))),
+      shift);
+  return _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC);
+}
+
+static inline void PostFilterbankNoiseReduction(
+    struct NoiseReductionState* noise_reduction, int channel,
+    const uint32_t* input, uint32_t* reduced) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i signal = _mm_loadu_si128((const __m128i*)input);
+  uint32_t* estimate_pointer = noise_reduction->estimate + channel;
+  const __m128i previous_estimate =
+      _mm_loadu_si128((const __m128i*)estimate_pointer);
+
+  const __m128i smoothing =
+      _mm_setr_epi32(noise_reduction->even_smoothing,
+                     noise_reduction->odd_smoothing,
+                     noise_reduction->even_smoothing,
+                     noise_reduction->odd_smoothing);
+  const __m128i one_minus_smoothing =
+      _mm_sub_epi32(_mm_set1_epi32(1 << kNoiseReductionBits), smoothing);
+  const __m128i smoothing_bits =
+      _mm_cvtsi32_si128(noise_reduction->smoothing_bits);
+  const __m128i noise_reduction_bits = _mm_cvtsi32_si128(kNoiseReductionBits);
+  const __m128i signal_scaled_up = _mm_sll_epi32(signal, smoothing_bits);
+  const __m128i estimate = PostFilterbankMulAddShift(
+      signal_scaled_up, smoothing, previous_estimate, one_minus_smoothing,
+      noise_reduction_bits);
+  _mm_storeu_si128((__m128i*)estimate_pointer, estimate);
+
+  const __m128i floor = PostFilterbankMulAddShift(
+      signal, _mm_set1_epi32(noise_reduction->min_signal_remaining), zero,
+      zero, noise_reduction_bits);
+  const __m128i subtracted = _mm_srl_epi32(
+      _mm_sub_epi32(signal_scaled_up, _mm_min_epu32(estimate, signal_scaled_up)),
+      smoothing_bits);
+  _mm_storeu_si128((__m128i*)reduced, _mm_max_epu32(subtracted, floor));
+}
+
+#endif
+
+// Runs noise reduction, PCAN and log scaling on signal and returns the
+// logged values, written over the start of signal like LogScaleApply does.
+// PCAN and log scaling must both be enabled, with the PCAN noise estimate
+// being the noise reduction estimate.
+static inline uint16_t* PostFilterbankApply(
+    struct NoiseReductionState* noise_reduction,
+    const struct PcanGainControlState* pcan_gain_control,
+    const struct LogScaleState* log_scale, int correction_bits,
+    uint32_t* signal) {
+  uint16_t* output = (uint16_t*)signal;
+  const int num_channels = noise_reduction->num_channels;
+  const int scale_shift = log_scale->scale_shift;
+  int i = 0;
+#if defined(POST_FILTERBANK_KERNELS_NEON) || \
+    defined(POST_FILTERBANK_KERNELS_SSE4_1)
+  // Each block reads four channels before writing the first half of their
+  // bytes, so the in-place output never overtakes the input.
+  for (; i + 4 <= num_channels; i += 4) {
+    uint32_t reduced[4];
+    PostFilterbankNoiseReduction(noise_reduction, i, signal + i, reduced);
+    const uint32_t* estimate = noise_reduction->estimate + i;
+    int j;
+    for (j = 0; j < 4; ++j) {
+      output[i + j] =
+          PostFilterbankFinish(pcan_gain_control, scale_shift,
+                               correction_bits, estimate[j], reduced[j]);
+    }
+  }
+#endif
+  for (; i < num_channels; ++i) {
+    output[i] = PostFilterbankChannel(noise_reduction, pcan_gain_control,
+                                      scale_shift, correction_bits, i,
+                                      signal[i]);
+  }
+  return output;
+}
+
+#ifdef __cplusplus
+}  
+#endif
+
+#endif  
@@ -0,0 +1,230 @@
+#include "tensorflow/lite/experimental/microfrontend/lib/trace.h"
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#if defined(MICROFEATURES_TRACING) && defined(__ANDROID__)
+#include <android/trace.h>
+#endif
+
+struct TraceEvent {
+  const char* name;
+  uint64_t start_ns;
+  uint64_t duration_ns;
+};
+
+// Written only by the thread that owns it. generation and count are published
+// with release order so a reader that acquires them sees the spans below
+// count. Buffers are never freed, since the reader may walk them at any time;
+// when a thread exits its buffer is released and a later thread takes it
+// over once its spans no longer belong to the running trace.
+struct TraceBuffer {
+  struct TraceBuffer* next;
+  atomic_int in_use;
+  long tid;
+  atomic_uint generation;
+  atomic_size_t count;
+  int depth;
+  uint64_t open_start_ns[kTraceMaxDepth];
+  const char* open_name[kTraceMaxDepth];
+  struct TraceEvent events[kTraceEventsPerThread];
+};
+
+static _Atomic(struct TraceBuffer*) trace_buffers;
+static _Thread_local struct TraceBuffer* thread_buffer;
+static atomic_int trace_started;
+// Bumped by TraceStart; a buffer from an older generation is cleared by its
+// thread before it records again, and skipped by TraceWriteJson.
+static atomic_uint trace_generation;
+
+static uint64_t MonotonicNs(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+static _Atomic(TraceClock) trace_clock = MonotonicNs;
+
+static pthread_once_t thread_exit_once = PTHREAD_ONCE_INIT;
+static pthread_key_t thread_exit_key;
+
+static void ReleaseThreadBuffer(void* buffer) {
+  atomic_store_explicit(&((struct TraceBuffer*)buffer)->in_use, 0,
+                        memory_order_release);
+}
+
+static void CreateThreadExitKey(void) {
+  pthread_key_create(&thread_exit_key, ReleaseThreadBuffer);
+}
+
+static uint64_t TraceNow(void) {
+  return atomic_load_explicit(&trace_clock, memory_order_acquire)();
+}
+
+static long ThreadId(void) {
+#if defined(__linux__)
+  return (long)syscall(SYS_gettid);
+#else
+  return 0;
+#endif
+}
+
+// Takes over a buffer released by an exited thread, unless it still holds
+// spans of the running trace.
+static struct TraceBuffer* ReuseBuffer(unsigned generation) {
+  for (struct TraceBuffer* buffer =
+           atomic_load_explicit(&trace_buffers, memory_order_acquire);
+       buffer != NULL; buffer = buffer->next) {
+    if (atomic_load_explicit(&buffer->in_use, memory_order_relaxed) ||
+        (atomic_load_explicit(&buffer->generation, memory_order_relaxed) ==
+             generation &&
+         atomic_load_explicit(&buffer->count, memory_order_relaxed) > 0)) {
+      continue;
+    }
+    int expected = 0;
+    if (atomic_compare_exchange_strong_explicit(&buffer->in_use, &expected, 1,
+                                                memory_order_acquire,
+                                                memory_order_relaxed)) {
+      return buffer;
+    }
+  }
+  return NULL;
+}
+
+static struct TraceBuffer* ThreadBuffer(unsigned generation) {
+  struct TraceBuffer* buffer = thread_buffer;
+  if (buffer == NULL) {
+    pthread_once(&thread_exit_once, CreateThreadExitKey);
+    buffer = ReuseBuffer(generation);
+    if (buffer == NULL) {
+      buffer = calloc(1, sizeof(*buffer));
+      if (buffer == NULL) {
+        return NULL;
+      }
+      atomic_init(&buffer->in_use, 1);
+      buffer->next = atomic_load_explicit(&trace_buffers, memory_order_relaxed);
+      while (!atomic_compare_exchange_weak_explicit(&trace_buffers,
+                                                    &buffer->next, buffer,
+                                                    memory_order_release,
+                                                    memory_order_relaxed)) {
+      }
+    }
+    buffer->tid = ThreadId();
+    buffer->depth = 0;
+    atomic_store_explicit(&buffer->count, 0, memory_order_relaxed);
+    atomic_store_explicit(&buffer->generation, generation,
+                          memory_order_release);
+    pthread_setspecific(thread_exit_key, buffer);
+    thread_buffer = buffer;
+  } else if (atomic_load_explicit(&buffer->generation, memory_order_relaxed) !=
+             generation) {
+    atomic_store_explicit(&buffer->count, 0, memory_order_relaxed);
+    buffer->depth = 0;
+    atomic_store_explicit(&buffer->generation, generation,
+                          memory_order_release);
+  }
+  return buffer;
+}
+
+void TraceStart(void) {
+  atomic_fetch_add_explicit(&trace_generation, 1, memory_order_relaxed);
+  atomic_store_explicit(&trace_started, 1, memory_order_release);
+}
+
+void TraceStop(void) {
+  atomic_store_explicit(&trace_started, 0, memory_order_release);
+}
+
+int TraceIsStarted(void) {
+  return atomic_load_explicit(&trace_started, memory_order_relaxed);
+}
+
+void TraceBegin(const char* name) {
+#if defined(MICROFEATURES_TRACING) && defined(__ANDROID__)
+  ATrace_beginSection(name);
+#endif
+  if (!atomic_load_explicit(&trace_started, memory_order_acquire)) {
+    return;
+  }
+  struct TraceBuffer* buffer = ThreadBuffer(
+      atomic_load_explicit(&trace_generation, memory_order_relaxed));
+  if (buffer == NULL) {
+    return;
+  }
+  if (buffer->depth < kTraceMaxDepth) {
+    buffer->open_name[buffer->depth] = name;
+    buffer->open_start_ns[buffer->depth] = TraceNow();
+  }
+  buffer->depth++;
+}
+
+void TraceEnd(void) {
+#if defined(MICROFEATURES_TRACING) && defined(__ANDROID__)
+  ATrace_endSection();
+#endif
+  struct TraceBuffer* buffer = thread_buffer;
+  if (!atomic_load_explicit(&trace_started, memory_order_acquire) ||
+      buffer == NULL || buffer->depth == 0 ||
+      atomic_load_explicit(&buffer->generation, memory_order_relaxed) !=
+          atomic_load_explicit(&trace_generation, memory_order_relaxed)) {
+    return;
+  }
+  buffer->depth--;
+  if (buffer->depth >= kTraceMaxDepth) {
+    return;
+  }
+  const size_t count =
+      atomic_load_explicit(&buffer->count, memory_order_relaxed);
+  struct TraceEvent* event = &buffer->events[count % kTraceEventsPerThread];
+  event->name = buffer->open_name[buffer->depth];
+  event->start_ns = buffer->open_start_ns[buffer->depth];
+  event->duration_ns = TraceNow() - event->start_ns;
+  atomic_store_explicit(&buffer->count, count + 1, memory_order_release);
+}
+
+void TraceSetClock(TraceClock clock) {
+  atomic_store_explicit(&trace_clock, clock != NULL ? clock : MonotonicNs,
+                        memory_order_release);
+}
+
+size_t TraceWriteJson(FILE* file) {
+  const unsigned generation =
+      atomic_load_explicit(&trace_generation, memory_order_relaxed);
+  const int pid = (int)getpid();
+  size_t written = 0;
+  fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+  for (struct TraceBuffer* buffer =
+           atomic_load_explicit(&trace_buffers, memory_order_acquire);
+       buffer != NULL; buffer = buffer->next) {
+    if (atomic_load_explicit(&buffer->generation, memory_order_acquire) !=
+        generation) {
+      continue;
+    }
+    const size_t count =
+        atomic_load_explicit(&buffer->count, memory_order_acquire);
+    const size_t first =
+        count > kTraceEventsPerThread ? count - kTraceEventsPerThread : 0;
+    for (size_t i = first; i < count; ++i) {
+      const struct TraceEvent* event =
+          &buffer->events[i % kTraceEventsPerThread];
+      // Chrome traces count in microseconds; three decimals keep the
+      // nanoseconds without going through floating point.
+      fprintf(file,
+              "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%ld,"
+              "\"ts\":%" PRIu64 ".%03u,\"dur\":%" PRIu64 ".%03u}",
+              written == 0 ? "" : ",", event->name, pid, buffer->tid,
+              event->start_ns / 1000, (unsigned)(event->start_ns % 1000),
+              event->duration_ns / 1000, (unsigned)(event->duration_ns % 1000));
+      written++;
+    }
+  }
+  fprintf(file, "\n]}\n");
+  return written;
+}
@@ -0,0 +1,56 @@
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_TRACE_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_TRACE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Opt-in span tracing for the audio path. With MICROFEATURES_TRACING defined,
+// TRACE_BEGIN and TRACE_END record a span into a buffer owned by the calling
+// thread while tracing is started, and on Android also open and close an
+// ATrace section. Without it they compile to nothing. The recorded spans are
+// written out as Chrome trace JSON, which Perfetto and chrome://tracing load.
+#ifdef MICROFEATURES_TRACING
+#define TRACE_BEGIN(name) TraceBegin(name)
+#define TRACE_END() TraceEnd()
+#else
+#define TRACE_BEGIN(name) ((void)0)
+#define TRACE_END() ((void)0)
+#endif
+
+// Spans each thread keeps; once full, its oldest spans are overwritten.
+#define kTraceEventsPerThread 8192
+// Deepest nesting of open spans per thread. Deeper spans are not recorded.
+#define kTraceMaxDepth 16
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint64_t (*TraceClock)(void);
+
+// Clears every thread's spans and starts recording.
+void TraceStart(void);
+
+// Stops recording. Spans still open are not recorded.
+void TraceStop(void);
+
+int TraceIsStarted(void);
+
+// name must outlive the trace; string literals are expected.
+void TraceBegin(const char* name);
+
+void TraceEnd(void);
+
+// Replaces the nanosecond clock spans are timed with, CLOCK_MONOTONIC by
+// default, so tests can produce deterministic traces. NULL restores it.
+void TraceSetClock(TraceClock clock);
+
+// Writes the spans recorded by all threads as a Chrome trace JSON object.
+// Call it after TraceStop. Returns the number of spans written.
+size_t TraceWriteJson(FILE* file);
+
+#ifdef __cplusplus
+}  
+#endif
+
+#endif  
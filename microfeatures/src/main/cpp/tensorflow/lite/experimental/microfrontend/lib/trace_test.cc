@@ -0,0 +1,143 @@
+#include "tensorflow/lite/experimental/microfrontend/lib/trace.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <thread>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_fixed.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_util.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace {
+
+uint64_t stub_now = 0;
+
+// Advances 100 ns on every reading.
+uint64_t StubClock() {
+  stub_now += 100;
+  return stub_now;
+}
+
+std::string WriteJson(size_t* num_spans) {
+  FILE* file = tmpfile();
+  *num_spans = TraceWriteJson(file);
+  std::string json(ftell(file), '\0');
+  rewind(file);
+  fread(&json[0], 1, json.size(), file);
+  fclose(file);
+  return json;
+}
+
+size_t CountOf(const std::string& json, const char* needle) {
+  size_t count = 0;
+  for (size_t at = json.find(needle); at != std::string::npos;
+       at = json.find(needle, at + 1)) {
+    count++;
+  }
+  return count;
+}
+
+}
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(Trace_RecordsNestedSpansWhileStarted) {
+  TraceSetClock(StubClock);
+  stub_now = 0;
+  TraceBegin("ignored");
+  TraceEnd();
+
+  TraceStart();
+  TF_LITE_MICRO_EXPECT(TraceIsStarted());
+  TraceBegin("outer");
+  TraceBegin("inner");
+  TraceEnd();
+  TraceEnd();
+  std::thread([] {
+    TraceBegin("other_thread");
+    TraceEnd();
+  }).join();
+  TraceStop();
+  TraceBegin("stopped");
+  TraceEnd();
+
+  size_t num_spans = 0;
+  const std::string json = WriteJson(&num_spans);
+  TF_LITE_MICRO_EXPECT_EQ(num_spans, 3u);
+  TF_LITE_MICRO_EXPECT_EQ(json.find("{\"displayTimeUnit\""), 0u);
+  TF_LITE_MICRO_EXPECT(
+      json.find("\"name\":\"inner\",\"ph\":\"X\"") != std::string::npos);
+  TF_LITE_MICRO_EXPECT(json.find("\"ts\":0.200,\"dur\":0.100}") !=
+                       std::string::npos);
+  TF_LITE_MICRO_EXPECT(json.find("\"ts\":0.100,\"dur\":0.300}") !=
+                       std::string::npos);
+  TF_LITE_MICRO_EXPECT_EQ(CountOf(json, "other_thread"), 1u);
+  TF_LITE_MICRO_EXPECT_EQ(CountOf(json, "ignored"), 0u);
+  TF_LITE_MICRO_EXPECT_EQ(CountOf(json, "stopped"), 0u);
+  TraceSetClock(NULL);
+}
+
+TF_LITE_MICRO_TEST(Trace_StartClearsAndFullBufferKeepsNewest) {
+  TraceSetClock(StubClock);
+  TraceStart();
+  for (int i = 0; i < kTraceEventsPerThread + 5; ++i) {
+    TraceBegin(i < 5 ? "oldest" : "span");
+    TraceEnd();
+  }
+  TraceStop();
+  size_t num_spans = 0;
+  std::string json = WriteJson(&num_spans);
+  TF_LITE_MICRO_EXPECT_EQ(num_spans, (size_t)kTraceEventsPerThread);
+  TF_LITE_MICRO_EXPECT_EQ(CountOf(json, "oldest"), 0u);
+  TF_LITE_MICRO_EXPECT_EQ(CountOf(json, "outer"), 0u);
+
+  TraceStart();
+  TraceStop();
+  json = WriteJson(&num_spans);
+  TF_LITE_MICRO_EXPECT_EQ(num_spans, 0u);
+  TraceSetClock(NULL);
+}
+
+TF_LITE_MICRO_TEST(Trace_ExitedThreadsKeepSpansUntilRestart) {
+  TraceSetClock(StubClock);
+  for (int round = 0; round < 3; ++round) {
+    TraceStart();
+    // The second thread may take over the first one's buffer only once the
+    // first one's spans are from an earlier trace.
+    for (int thread = 0; thread < 2; ++thread) {
+      std::thread([thread] {
+        TraceBegin(thread == 0 ? "first_thread" : "second_thread");
+        TraceEnd();
+      }).join();
+    }
+    TraceStop();
+    size_t num_spans = 0;
+    const std::string json = WriteJson(&num_spans);
+    TF_LITE_MICRO_EXPECT_EQ(num_spans, 2u);
+    TF_LITE_MICRO_EXPECT_EQ(CountOf(json, "first_thread"), 1u);
+    TF_LITE_MICRO_EXPECT_EQ(CountOf(json, "second_thread"), 1u);
+  }
+  TraceSetClock(NULL);
+}
+
+#ifdef MICROFEATURES_TRACING
+TF_LITE_MICRO_TEST(Trace_FrontendStagesRecordSpans) {
+  struct FrontendState state;
+  TF_LITE_MICRO_EXPECT(FrontendFixedPopulateState(&state));
+  int16_t samples[480] = {0};
+  size_t num_samples_read = 0;
+  TraceStart();
+  FrontendFixedProcessSamples(&state, samples, 480, &num_samples_read);
+  TraceStop();
+  size_t num_spans = 0;
+  const std::string json = WriteJson(&num_spans);
+  TF_LITE_MICRO_EXPECT_EQ(num_spans, 4u);
+  TF_LITE_MICRO_EXPECT_EQ(CountOf(json, "\"frontend.fft\""), 1u);
+  TF_LITE_MICRO_EXPECT_EQ(CountOf(json, "\"frontend.post_filterbank\""), 1u);
+  FrontendFreeStateContents(&state);
+}
+#endif
+
+TF_LITE_MICRO_TESTS_END
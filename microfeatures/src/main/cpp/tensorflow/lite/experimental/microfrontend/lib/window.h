@@ -11,15 +11,21 @@
 extern "C" {
 #endif
 
+struct FrontendKernels;
+
 struct WindowState {
   size_t size;
   int16_t* coefficients;
   size_t step;
 
+  // Circular buffer of size samples; the oldest one is at input_start.
   int16_t* input;
+  size_t input_start;
   size_t input_used;
   int16_t* output;
   int16_t max_abs_output_value;
+  // Chosen for the CPU by WindowPopulateState; see frontend_kernels.h.
+  const struct FrontendKernels* kernels;
 };
 
 
@@ -23,6 +23,7 @@ void WindowWriteMemmap(FILE* fp, const struct WindowState* state,
   fprintf(fp, "%s->step = %zu;\n", variable, state->step);
 
   fprintf(fp, "%s->input = window_input;\n", variable);
+  fprintf(fp, "%s->input_start = %zu;\n", variable, state->input_start);
   fprintf(fp, "%s->input_used = %zu;\n", variable, state->input_used);
   fprintf(fp, "%s->output = window_output;\n", variable);
   fprintf(fp, "%s->max_abs_output_value = %d;\n", variable,
@@ -0,0 +1,95 @@
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_WINDOW_KERNELS_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_WINDOW_KERNELS_H_
+
+#include <stdint.h>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/window.h"
+
+#if defined(FRONTEND_KERNELS_SCALAR)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define WINDOW_KERNELS_NEON 1
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define WINDOW_KERNELS_SSE4_1 1
+#endif
+
+// Multiplies count samples by the window coefficients and returns the larger
+// of max_abs_output_value and the largest magnitude written. Like the scalar
+// loop, the vector versions keep the low 16 bits of each shifted product and
+// let the magnitude of -32768 wrap, so it never raises the maximum.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static inline int16_t WindowApplyScalar(const int16_t* input,
+                                        const int16_t* coefficients,
+                                        int16_t* output, int count,
+                                        int16_t max_abs_output_value) {
+  int i;
+  for (i = 0; i < count; ++i) {
+    int16_t new_value =
+        (((int32_t)input[i]) * coefficients[i]) >> kFrontendWindowBits;
+    output[i] = new_value;
+    if (new_value < 0) {
+      new_value = -new_value;
+    }
+    if (new_value > max_abs_output_value) {
+      max_abs_output_value = new_value;
+    }
+  }
+  return max_abs_output_value;
+}
+
+static inline int16_t WindowApply(const int16_t* input,
+                                  const int16_t* coefficients, int16_t* output,
+                                  int count, int16_t max_abs_output_value) {
+  int i = 0;
+#if defined(WINDOW_KERNELS_NEON)
+  int16x8_t max_abs = vdupq_n_s16(max_abs_output_value);
+  for (; i + 8 <= count; i += 8) {
+    const int16x8_t samples = vld1q_s16(input + i);
+    const int16x8_t weights = vld1q_s16(coefficients + i);
+    const int16x8_t value = vcombine_s16(
+        vshrn_n_s32(vmull_s16(vget_low_s16(samples), vget_low_s16(weights)),
+                    kFrontendWindowBits),
+        vshrn_n_s32(vmull_s16(vget_high_s16(samples), vget_high_s16(weights)),
+                    kFrontendWindowBits));
+    vst1q_s16(output + i, value);
+    max_abs = vmaxq_s16(max_abs, vabsq_s16(value));
+  }
+  int16x4_t max_abs_half =
+      vpmax_s16(vget_low_s16(max_abs), vget_high_s16(max_abs));
+  max_abs_half = vpmax_s16(max_abs_half, max_abs_half);
+  max_abs_half = vpmax_s16(max_abs_half, max_abs_half);
+  max_abs_output_value = vget_lane_s16(max_abs_half, 0);
+#elif defined(WINDOW_KERNELS_SSE4_1)
+  __m128i max_abs = _mm_set1_epi16(max_abs_output_value);
+  for (; i + 8 <= count; i += 8) {
+    const __m128i samples = _mm_loadu_si128((const __m128i*)(input + i));
+    const __m128i weights =
+        _mm_loadu_si128((const __m128i*)(coefficients + i));
+    // Bits 12 to 27 of the 32-bit products, from their two halves.
+    const __m128i value = _mm_or_si128(
+        _mm_slli_epi16(_mm_mulhi_epi16(samples, weights),
+                       16 - kFrontendWindowBits),
+        _mm_srli_epi16(_mm_mullo_epi16(samples, weights),
+                       kFrontendWindowBits));
+    _mm_storeu_si128((__m128i*)(output + i), value);
+    max_abs = _mm_max_epi16(max_abs, _mm_abs_epi16(value));
+  }
+  max_abs = _mm_max_epi16(max_abs, _mm_srli_si128(max_abs, 8));
+  max_abs = _mm_max_epi16(max_abs, _mm_srli_si128(max_abs, 4));
+  max_abs = _mm_max_epi16(max_abs, _mm_srli_si128(max_abs, 2));
+  max_abs_output_value = (int16_t)_mm_extract_epi16(max_abs, 0);
+#endif
+  return WindowApplyScalar(input + i, coefficients + i, output + i, count - i,
+                           max_abs_output_value);
+}
+
+#ifdef __cplusplus
+}  
+#endif
+
+#endif  
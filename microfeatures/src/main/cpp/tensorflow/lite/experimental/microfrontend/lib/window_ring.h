@@ -0,0 +1,71 @@
+#ifndef TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_WINDOW_RING_H_
+#define TENSORFLOW_LITE_EXPERIMENTAL_MICROFRONTEND_LIB_WINDOW_RING_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
+#include "tensorflow/lite/experimental/microfrontend/lib/window.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Appends samples to the window's ring buffer and, once size samples are
+// held, applies the window and advances by step. Shared by
+// WindowProcessSamples and the fixed frontend, which passes its size, step
+// and coefficients as constants so the index arithmetic folds away.
+static inline int WindowRingProcessSamples(struct WindowState* state,
+                                           const int16_t* coefficients,
+                                           size_t size, size_t step,
+                                           const int16_t* samples,
+                                           size_t num_samples,
+                                           size_t* num_samples_read) {
+  size_t max_samples_to_copy = size - state->input_used;
+  if (max_samples_to_copy > num_samples) {
+    max_samples_to_copy = num_samples;
+  }
+  size_t write_index = state->input_start + state->input_used;
+  if (write_index >= size) {
+    write_index -= size;
+  }
+  size_t first_copy = size - write_index;
+  if (first_copy > max_samples_to_copy) {
+    first_copy = max_samples_to_copy;
+  }
+  memcpy(state->input + write_index, samples, first_copy * sizeof(*samples));
+  memcpy(state->input, samples + first_copy,
+         (max_samples_to_copy - first_copy) * sizeof(*samples));
+  *num_samples_read = max_samples_to_copy;
+  state->input_used += max_samples_to_copy;
+
+  if (state->input_used < size) {
+    return 0;
+  }
+
+  // The window starts at input_start and wraps around to the beginning of
+  // the buffer, so it is applied in two contiguous segments.
+  const size_t start = state->input_start;
+  const int first_segment = size - start;
+  const struct FrontendKernels* kernels = state->kernels;
+  int16_t max_abs_output_value =
+      kernels->window_apply(state->input + start, coefficients, state->output,
+                            first_segment, 0);
+  max_abs_output_value = kernels->window_apply(
+      state->input, coefficients + first_segment,
+      state->output + first_segment, start, max_abs_output_value);
+
+  state->input_start = start + step;
+  if (state->input_start >= size) {
+    state->input_start -= size;
+  }
+  state->input_used -= step;
+  state->max_abs_output_value = max_abs_output_value;
+  return 1;
+}
+
+#ifdef __cplusplus
+}  
+#endif
+
+#endif  
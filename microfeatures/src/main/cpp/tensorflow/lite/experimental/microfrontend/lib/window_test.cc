@@ -1,6 +1,7 @@
 
 #include "tensorflow/lite/experimental/microfrontend/lib/window.h"
 
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
 #include "tensorflow/lite/experimental/microfrontend/lib/window_util.h"
 #include "tensorflow/lite/micro/testing/micro_test.h"
 
@@ -15,6 +16,11 @@ const int16_t kFakeAudioData[] = {
     0, 32767, 0, -32768, 0, 32767, 0, -32768, 0, 32767, 0, -32768};
 
 
+uint32_t NextRandom(uint32_t* seed) {
+  *seed = *seed * 1103515245 + 12345;
+  return *seed;
+}
+
 class WindowTestConfig {
  public:
   WindowTestConfig() {
@@ -60,7 +66,9 @@ TF_LITE_MICRO_TEST(WindowState_CheckResidualInput) {
 
   int i;
   for (i = kStepSamples; i < kWindowSamples; ++i) {
-    TF_LITE_MICRO_EXPECT_EQ(state.input[i - kStepSamples], kFakeAudioData[i]);
+    TF_LITE_MICRO_EXPECT_EQ(
+        state.input[(state.input_start + i - kStepSamples) % state.size],
+        kFakeAudioData[i]);
   }
 
   WindowFreeStateContents(&state);
@@ -158,4 +166,37 @@ TF_LITE_MICRO_TEST(WindowState_CheckNotEnoughSamples) {
   WindowFreeStateContents(&state);
 }
 
+TF_LITE_MICRO_TEST(WindowState_ApplyKernelMatchesScalar) {
+  const int kCount = 480;
+  int16_t input[kCount];
+  int16_t coefficients[kCount];
+  uint32_t seed = 5;
+  for (int i = 0; i < kCount; ++i) {
+    input[i] = static_cast<int16_t>(NextRandom(&seed) >> 16);
+    coefficients[i] = static_cast<int16_t>((NextRandom(&seed) >> 16) % 4097);
+  }
+  input[3] = -32768;
+  coefficients[3] = 4096;
+
+  for (int variant = 0; variant < FrontendKernelsCount(); ++variant) {
+    const struct FrontendKernels* kernels = FrontendKernelsVariant(variant);
+    if (!FrontendKernelsSupported(kernels)) {
+      continue;
+    }
+    // Every length, to cover the vector loops and their tails.
+    for (int count = 0; count <= kCount; ++count) {
+      int16_t expected[kCount];
+      int16_t output[kCount];
+      const int16_t expected_max = kFrontendKernelsScalar.window_apply(
+          input, coefficients, expected, count, 7);
+      const int16_t max =
+          kernels->window_apply(input, coefficients, output, count, 7);
+      TF_LITE_MICRO_EXPECT_EQ(max, expected_max);
+      for (int i = 0; i < count; ++i) {
+        TF_LITE_MICRO_EXPECT_EQ(output[i], expected[i]);
+      }
+    }
+  }
+}
+
 TF_LITE_MICRO_TESTS_END
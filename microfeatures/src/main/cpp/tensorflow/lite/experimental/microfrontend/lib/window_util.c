@@ -6,6 +6,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_kernels.h"
+
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -37,6 +39,7 @@ int WindowPopulateState(const struct WindowConfig* config,
         floorf(float_value * (1 << kFrontendWindowBits) + 0.5f);
   }
 
+  state->input_start = 0;
   state->input_used = 0;
   state->input = malloc(state->size * sizeof(*state->input));
   if (state->input == NULL) {
@@ -50,6 +53,7 @@ int WindowPopulateState(const struct WindowConfig* config,
     return 0;
   }
 
+  state->kernels = FrontendKernelsSelect();
   return 1;
 }
 
@@ -0,0 +1,119 @@
+#ifndef TENSORFLOW_LITE_MICRO_TESTING_MICRO_TEST_H_
+#define TENSORFLOW_LITE_MICRO_TESTING_MICRO_TEST_H_
+
+#include <stdio.h>
+
+#include <cmath>
+
+// The subset of TensorFlow Lite Micro's test macros used by the
+// microfrontend tests, so they build on the host without the rest of TFLM.
+// Test bodies run in order inside main() and a failed expectation marks the
+// current test as failed without stopping it.
+
+namespace micro_test {
+extern int tests_passed;
+extern int tests_failed;
+extern bool is_test_complete;
+extern bool did_test_fail;
+}  // namespace micro_test
+
+#define TF_LITE_MICRO_TESTS_BEGIN   \
+  namespace micro_test {            \
+  int tests_passed;                 \
+  int tests_failed;                 \
+  bool is_test_complete;            \
+  bool did_test_fail;               \
+  }                                 \
+                                    \
+  int main(int argc, char** argv) { \
+    (void)argc;                     \
+    (void)argv;                     \
+    micro_test::tests_passed = 0;   \
+    micro_test::tests_failed = 0;
+
+#define TF_LITE_MICRO_TESTS_END                                  \
+  printf("%d/%d tests passed\n", micro_test::tests_passed,       \
+         (micro_test::tests_failed + micro_test::tests_passed)); \
+  if (micro_test::tests_failed == 0) {                           \
+    printf("~~~ALL TESTS PASSED~~~\n");                          \
+    return 0;                                                    \
+  } else {                                                       \
+    printf("~~~SOME TESTS FAILED~~~\n");                         \
+    return 1;                                                    \
+  }                                                              \
+  }
+
+#define TF_LITE_MICRO_TEST(name)                                           \
+  printf("Testing " #name "\n");                                           \
+  for (micro_test::is_test_complete = false,                               \
+      micro_test::did_test_fail = false;                                   \
+       !micro_test::is_test_complete; micro_test::is_test_complete = true, \
+      micro_test::tests_passed += (micro_test::did_test_fail) ? 0 : 1,     \
+      micro_test::tests_failed += (micro_test::did_test_fail) ? 1 : 0)
+
+#define TF_LITE_MICRO_EXPECT(x)                                      \
+  do {                                                               \
+    if (!(x)) {                                                      \
+      printf("%s failed at %s:%d\n", #x, __FILE__, __LINE__);        \
+      micro_test::did_test_fail = true;                              \
+    }                                                                \
+  } while (false)
+
+#define TF_LITE_MICRO_EXPECT_EQ(x, y)                                     \
+  do {                                                                    \
+    auto vx = x;                                                          \
+    auto vy = y;                                                          \
+    if ((vx) != (vy)) {                                                   \
+      printf("%s == %s failed at %s:%d (%lld vs %lld)\n", #x, #y,        \
+             __FILE__, __LINE__, static_cast<long long>(vx),              \
+             static_cast<long long>(vy));                                 \
+      micro_test::did_test_fail = true;                                   \
+    }                                                                     \
+  } while (false)
+
+#define TF_LITE_MICRO_EXPECT_NE(x, y)                                     \
+  do {                                                                    \
+    if ((x) == (y)) {                                                     \
+      printf("%s != %s failed at %s:%d\n", #x, #y, __FILE__, __LINE__);   \
+      micro_test::did_test_fail = true;                                   \
+    }                                                                     \
+  } while (false)
+
+#define TF_LITE_MICRO_EXPECT_NEAR(x, y, epsilon)                          \
+  do {                                                                    \
+    auto vx = (x);                                                        \
+    auto vy = (y);                                                        \
+    auto delta = ((vx) > (vy)) ? ((vx) - (vy)) : ((vy) - (vx));           \
+    if (std::isnan(static_cast<double>(vx)) !=                            \
+            std::isnan(static_cast<double>(vy)) ||                        \
+        delta > epsilon) {                                                \
+      printf("%s (%f) near %s (%f) failed at %s:%d\n", #x,                \
+             static_cast<double>(vx), #y, static_cast<double>(vy),        \
+             __FILE__, __LINE__);                                         \
+      micro_test::did_test_fail = true;                                   \
+    }                                                                     \
+  } while (false)
+
+#define TF_LITE_MICRO_EXPECT_GT(x, y)                                     \
+  do {                                                                    \
+    if ((x) <= (y)) {                                                     \
+      printf("%s > %s failed at %s:%d\n", #x, #y, __FILE__, __LINE__);    \
+      micro_test::did_test_fail = true;                                   \
+    }                                                                     \
+  } while (false)
+
+#define TF_LITE_MICRO_EXPECT_LE(x, y)                                     \
+  do {                                                                    \
+    if ((x) > (y)) {                                                      \
+      printf("%s <= %s failed at %s:%d\n", #x, #y, __FILE__, __LINE__);   \
+      micro_test::did_test_fail = true;                                   \
+    }                                                                     \
+  } while (false)
+
+#define TF_LITE_MICRO_FAIL(msg)                                \
+  do {                                                         \
+    printf("FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__);    \
+    micro_test::did_test_fail = true;                          \
+  } while (false)
+
+#endif  // TENSORFLOW_LITE_MICRO_TESTING_MICRO_TEST_H_
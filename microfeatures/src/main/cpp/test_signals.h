@@ -0,0 +1,159 @@
+#ifndef MICROFEATURES_TEST_SIGNALS_H_
+#define MICROFEATURES_TEST_SIGNALS_H_
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Deterministic 16 kHz test signals standing in for the kinds of audio the
+// frontend sees, for host benchmarks and tests that have no recordings.
+
+enum TestSignal {
+    kTestSignalSilence,
+    kTestSignalSpeech,
+    kTestSignalMusic,
+    kTestSignalWhiteNoise,
+    kTestSignalCount,
+};
+
+inline const char *TestSignalName(TestSignal signal) {
+    switch (signal) {
+        case kTestSignalSilence:
+            return "silence";
+        case kTestSignalSpeech:
+            return "speech";
+        case kTestSignalMusic:
+            return "music";
+        case kTestSignalWhiteNoise:
+            return "white noise";
+        default:
+            return "unknown";
+    }
+}
+
+class TestSignalRandom {
+public:
+    explicit TestSignalRandom(uint32_t seed) : state(seed) {}
+
+    // Uniform in [-1, 1).
+    float Next() {
+        state = state * 1103515245 + 12345;
+        return (float) ((int32_t) (state >> 8) - (1 << 23)) / (float) (1 << 23);
+    }
+
+private:
+    uint32_t state;
+};
+
+inline int16_t TestSignalClamp(float value) {
+    if (value > 32767.0f) {
+        return 32767;
+    }
+    if (value < -32768.0f) {
+        return -32768;
+    }
+    return (int16_t) lrintf(value);
+}
+
+// A two-pole resonator, used as a formant filter.
+struct TestSignalResonator {
+    float y1 = 0.0f;
+    float y2 = 0.0f;
+
+    float Filter(float x, float frequency, float bandwidth, float sample_rate) {
+        const float r = expf(-3.14159265f * bandwidth / sample_rate);
+        const float c = 2.0f * r * cosf(2.0f * 3.14159265f * frequency / sample_rate);
+        const float y = (1.0f - r) * x + c * y1 - r * r * y2;
+        y2 = y1;
+        y1 = y;
+        return y;
+    }
+};
+
+// Silence is the noise floor of an idle microphone, a few LSB of hiss.
+// Speech is a gliding glottal pulse train through three formant resonators
+// that move every syllable, with fricative bursts and pauses between words.
+// Music is a chord progression of decaying harmonic notes.
+inline std::vector<int16_t> GenerateTestSignal(TestSignal signal, size_t num_samples,
+                                               uint32_t seed) {
+    const float sample_rate = 16000.0f;
+    const float two_pi = 2.0f * 3.14159265f;
+    TestSignalRandom random(seed);
+    std::vector<int16_t> audio(num_samples);
+    switch (signal) {
+        case kTestSignalSilence:
+            for (size_t i = 0; i < num_samples; ++i) {
+                audio[i] = TestSignalClamp(4.0f * random.Next());
+            }
+            break;
+        case kTestSignalSpeech: {
+            // F1, F2 and F3 of the vowels /a/, /i/, /u/, /e/ and /o/.
+            static const float kFormants[5][3] = {
+                    {730, 1090, 2440}, {270, 2290, 3010}, {300, 870, 2240},
+                    {530, 1840, 2480}, {570, 840, 2410}};
+            const size_t syllable = (size_t) (0.18f * sample_rate);
+            TestSignalResonator resonators[3];
+            float phase = 0.0f;
+            for (size_t i = 0; i < num_samples; ++i) {
+                const size_t index = i / syllable;
+                const float position = (float) (i % syllable) / syllable;
+                const float t = i / sample_rate;
+                float value;
+                if (index % 7 == 6) {
+                    // A pause between words.
+                    value = 0.0f;
+                } else if (index % 3 == 2 && position < 0.3f) {
+                    // A fricative onset, noise shaped by the high formant.
+                    value = 0.3f * resonators[2].Filter(random.Next(), 4500.0f, 1500.0f,
+                                                        sample_rate);
+                } else {
+                    const float pitch = 120.0f + 40.0f * sinf(two_pi * 0.7f * t) +
+                                        20.0f * (float) (index % 4);
+                    phase += pitch / sample_rate;
+                    float pulse = 0.0f;
+                    if (phase >= 1.0f) {
+                        phase -= 1.0f;
+                        pulse = 1.0f;
+                    }
+                    const float *formants = kFormants[index % 5];
+                    value = resonators[0].Filter(pulse, formants[0], 90.0f, sample_rate) +
+                            0.5f * resonators[1].Filter(pulse, formants[1], 110.0f, sample_rate) +
+                            0.25f * resonators[2].Filter(pulse, formants[2], 170.0f, sample_rate);
+                    value *= sinf(3.14159265f * position);
+                }
+                audio[i] = TestSignalClamp(60000.0f * value + 8.0f * random.Next());
+            }
+            break;
+        }
+        case kTestSignalMusic: {
+            // Root notes of a I-V-vi-IV progression in C, one chord every
+            // half second, each note with five decaying harmonics.
+            static const float kRoots[4] = {261.63f, 392.00f, 440.00f, 349.23f};
+            static const float kChord[3] = {1.0f, 1.2599f, 1.4983f};
+            const size_t chord_length = (size_t) (0.5f * sample_rate);
+            for (size_t i = 0; i < num_samples; ++i) {
+                const float root = kRoots[(i / chord_length) % 4];
+                const float t = (float) (i % chord_length) / sample_rate;
+                const float envelope = expf(-3.0f * t);
+                float value = 0.0f;
+                for (int note = 0; note < 3; ++note) {
+                    for (int harmonic = 1; harmonic <= 5; ++harmonic) {
+                        value += sinf(two_pi * root * kChord[note] * harmonic * t) /
+                                 (float) (harmonic * harmonic);
+                    }
+                }
+                audio[i] = TestSignalClamp(5000.0f * envelope * value + 8.0f * random.Next());
+            }
+            break;
+        }
+        case kTestSignalWhiteNoise:
+        default:
+            for (size_t i = 0; i < num_samples; ++i) {
+                audio[i] = TestSignalClamp(8000.0f * random.Next());
+            }
+            break;
+    }
+    return audio;
+}
+
+#endif  // MICROFEATURES_TEST_SIGNALS_H_
@@ -0,0 +1,137 @@
+#ifndef MICROFEATURES_WAV_FILE_H_
+#define MICROFEATURES_WAV_FILE_H_
+
+#include <stdio.h>
+#include <string.h>
+
+#include <cstdint>
+#include <vector>
+
+// Minimal 16-bit PCM WAV reading and writing for host tests and tools.
+
+struct WavAudio {
+    uint32_t sample_rate = 0;
+    uint16_t num_channels = 0;
+    // Interleaved samples.
+    std::vector<int16_t> samples;
+};
+
+inline uint32_t WavRead32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+inline uint16_t WavRead16(const uint8_t *p) {
+    return (uint16_t) (p[0] | (p[1] << 8));
+}
+
+// Returns false unless path is a RIFF WAVE file of 16-bit PCM.
+inline bool ReadWav(const char *path, WavAudio *audio) {
+    FILE *fp = fopen(path, "rb");
+    if (fp == nullptr) {
+        return false;
+    }
+    std::vector<uint8_t> data;
+    uint8_t buffer[4096];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+        data.insert(data.end(), buffer, buffer + read);
+    }
+    fclose(fp);
+    if (data.size() < 12 || memcmp(data.data(), "RIFF", 4) != 0 ||
+        memcmp(data.data() + 8, "WAVE", 4) != 0) {
+        return false;
+    }
+    bool have_format = false;
+    size_t offset = 12;
+    while (offset + 8 <= data.size()) {
+        const uint8_t *chunk = data.data() + offset;
+        const size_t size = WavRead32(chunk + 4);
+        if (size > data.size() - offset - 8) {
+            return false;
+        }
+        if (memcmp(chunk, "fmt ", 4) == 0 && size >= 16) {
+            const uint16_t format = WavRead16(chunk + 8);
+            audio->num_channels = WavRead16(chunk + 10);
+            audio->sample_rate = WavRead32(chunk + 12);
+            const uint16_t bits_per_sample = WavRead16(chunk + 22);
+            if (format != 1 || bits_per_sample != 16 || audio->num_channels == 0) {
+                return false;
+            }
+            have_format = true;
+        } else if (memcmp(chunk, "data", 4) == 0 && have_format) {
+            audio->samples.resize(size / 2);
+            for (size_t i = 0; i < audio->samples.size(); ++i) {
+                audio->samples[i] = (int16_t) WavRead16(chunk + 8 + 2 * i);
+            }
+            return true;
+        }
+        offset += 8 + size + (size & 1);
+    }
+    return false;
+}
+
+inline void WavWrite32(FILE *fp, uint32_t value) {
+    const uint8_t bytes[4] = {(uint8_t) value, (uint8_t) (value >> 8), (uint8_t) (value >> 16),
+                              (uint8_t) (value >> 24)};
+    fwrite(bytes, 1, 4, fp);
+}
+
+inline void WavWrite16(FILE *fp, uint16_t value) {
+    const uint8_t bytes[2] = {(uint8_t) value, (uint8_t) (value >> 8)};
+    fwrite(bytes, 1, 2, fp);
+}
+
+inline bool WriteWav(const char *path, const WavAudio &audio) {
+    FILE *fp = fopen(path, "wb");
+    if (fp == nullptr) {
+        return false;
+    }
+    const uint32_t data_size = (uint32_t) (audio.samples.size() * 2);
+    fwrite("RIFF", 1, 4, fp);
+    WavWrite32(fp, 36 + data_size);
+    fwrite("WAVEfmt ", 1, 8, fp);
+    WavWrite32(fp, 16);
+    WavWrite16(fp, 1);
+    WavWrite16(fp, audio.num_channels);
+    WavWrite32(fp, audio.sample_rate);
+    WavWrite32(fp, audio.sample_rate * audio.num_channels * 2);
+    WavWrite16(fp, (uint16_t) (audio.num_channels * 2));
+    WavWrite16(fp, 16);
+    fwrite("data", 1, 4, fp);
+    WavWrite32(fp, data_size);
+    for (int16_t sample : audio.samples) {
+        WavWrite16(fp, (uint16_t) sample);
+    }
+    return fclose(fp) == 0;
+}
+
+// Averages the channels and linearly resamples to sample_rate, in integer
+// arithmetic so the result is the same on every platform.
+inline std::vector<int16_t> WavToMono(const WavAudio &audio, uint32_t sample_rate) {
+    const size_t num_frames = audio.samples.size() / audio.num_channels;
+    std::vector<int32_t> mono(num_frames);
+    for (size_t i = 0; i < num_frames; ++i) {
+        int32_t sum = 0;
+        for (uint16_t channel = 0; channel < audio.num_channels; ++channel) {
+            sum += audio.samples[i * audio.num_channels + channel];
+        }
+        mono[i] = sum / audio.num_channels;
+    }
+    if (num_frames == 0) {
+        return std::vector<int16_t>();
+    }
+    const size_t num_output = (size_t) ((uint64_t) num_frames * sample_rate / audio.sample_rate);
+    std::vector<int16_t> output(num_output);
+    for (size_t i = 0; i < num_output; ++i) {
+        // Position in the input in 16.16 fixed point.
+        const uint64_t position = ((uint64_t) i * audio.sample_rate << 16) / sample_rate;
+        const size_t index = (size_t) (position >> 16);
+        const int64_t fraction = (int64_t) (position & 0xFFFF);
+        const int64_t a = mono[index];
+        const int64_t b = index + 1 < num_frames ? mono[index + 1] : a;
+        output[i] = (int16_t) ((a * (65536 - fraction) + b * fraction) >> 16);
+    }
+    return output;
+}
+
+#endif  // MICROFEATURES_WAV_FILE_H_
@@ -0,0 +1,29 @@
+/*
+ *  Copyright (c) 2012 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef WEBRTC_MODULES_AUDIO_PROCESSING_NS_FFT4G_H_
+#define WEBRTC_MODULES_AUDIO_PROCESSING_NS_FFT4G_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Ooura's real FFT, which the noise suppressor used before its transforms
+// moved into NsKernels. It is no longer built into the library and is kept
+// as the reference those kernels are tested against. ip[0] = 0 on the first
+// call fills the tables in ip and w for length n.
+void WebRtc_rdft(size_t n, int isgn, float *a, size_t *ip, float *w);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // WEBRTC_MODULES_AUDIO_PROCESSING_NS_FFT4G_H_
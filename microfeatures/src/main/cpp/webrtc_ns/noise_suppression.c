@@ -14,6 +14,8 @@
 #include <math.h>
 #include <stdlib.h>
 
+#include "tensorflow/lite/experimental/microfrontend/lib/trace.h"
+
 #ifndef SPL_SAT
 #define SPL_SAT(a, b, c)         ((b) > (a) ? (a) : (b) < (c) ? (c) : (b))
 #endif
@@ -105,604 +107,6 @@ static const float kBlocks160w256[256] = {
         (float) 0.01636173
 };
 
-/*
- * http://www.kurims.kyoto-u.ac.jp/~ooura/fft.html
- * Copyright Takuya OOURA, 1996-2001
- *
- * You may use, copy, modify and distribute this code for any purpose (include
- * commercial use) and without fee. Please refer to this package when you modify
- * this code.
- *
- * Changes:
- * Trivial type modifications by the WebRTC authors.
- */
-
-static void makewt(size_t nw, size_t *ip, float *w);
-
-static void makect(size_t nc, size_t *ip, float *c);
-
-static void bitrv2(size_t n, size_t *ip, float *a);
-
-static void cftfsub(size_t n, float *a, float *w);
-
-static void cftbsub(size_t n, float *a, float *w);
-
-static void cft1st(size_t n, float *a, float *w);
-
-static void cftmdl(size_t n, size_t l, float *a, float *w);
-
-static void rftfsub(size_t n, float *a, size_t nc, float *c);
-
-static void rftbsub(size_t n, float *a, size_t nc, float *c);
-
-
-void WebRtc_rdft(size_t n, int isgn, float *a, size_t *ip, float *w) {
-    size_t nw, nc;
-    float xi;
-
-    nw = ip[0];
-    if (n > (nw << 2)) {
-        nw = n >> 2;
-        makewt(nw, ip, w);
-    }
-    nc = ip[1];
-    if (n > (nc << 2)) {
-        nc = n >> 2;
-        makect(nc, ip, w + nw);
-    }
-    if (isgn >= 0) {
-        if (n > 4) {
-            bitrv2(n, ip + 2, a);
-            cftfsub(n, a, w);
-            rftfsub(n, a, nc, w + nw);
-        } else if (n == 4) {
-            cftfsub(n, a, w);
-        }
-        xi = a[0] - a[1];
-        a[0] += a[1];
-        a[1] = xi;
-    } else {
-        a[1] = 0.5f * (a[0] - a[1]);
-        a[0] -= a[1];
-        if (n > 4) {
-            rftbsub(n, a, nc, w + nw);
-            bitrv2(n, ip + 2, a);
-            cftbsub(n, a, w);
-        } else if (n == 4) {
-            cftfsub(n, a, w);
-        }
-    }
-}
-
-/* -------- initializing routines -------- */
-
-
-
-static void makewt(size_t nw, size_t *ip, float *w) {
-    size_t j, nwh;
-    float delta, x, y;
-
-    ip[0] = nw;
-    ip[1] = 1;
-    if (nw > 2) {
-        nwh = nw >> 1;
-        delta = atanf(1.f) / nwh;
-        w[0] = 1;
-        w[1] = 0;
-        w[nwh] = cosf(delta * nwh);
-        w[nwh + 1] = w[nwh];
-        if (nwh > 2) {
-            for (j = 2; j < nwh; j += 2) {
-                x = cosf(delta * j);
-                y = sinf(delta * j);
-                w[j] = x;
-                w[j + 1] = y;
-                w[nw - j] = y;
-                w[nw - j + 1] = x;
-            }
-            bitrv2(nw, ip + 2, w);
-        }
-    }
-}
-
-
-static void makect(size_t nc, size_t *ip, float *c) {
-    size_t j, nch;
-    float delta;
-
-    ip[1] = nc;
-    if (nc > 1) {
-        nch = nc >> 1;
-        delta = atanf(1.f) / nch;
-        c[0] = cosf(delta * nch);
-        c[nch] = 0.5f * c[0];
-        for (j = 1; j < nch; j++) {
-            c[j] = 0.5f * cosf(delta * j);
-            c[nc - j] = 0.5f * sinf(delta * j);
-        }
-    }
-}
-
-
-/* -------- child routines -------- */
-
-
-static void bitrv2(size_t n, size_t *ip, float *a) {
-    size_t j, j1, k, k1, l, m, m2;
-    float xr, xi, yr, yi;
-
-    ip[0] = 0;
-    l = n;
-    m = 1;
-    while ((m << 3) < l) {
-        l >>= 1;
-        for (j = 0; j < m; j++) {
-            ip[m + j] = ip[j] + l;
-        }
-        m <<= 1;
-    }
-    m2 = 2 * m;
-    if ((m << 3) == l) {
-        for (k = 0; k < m; k++) {
-            for (j = 0; j < k; j++) {
-                j1 = 2 * j + ip[k];
-                k1 = 2 * k + ip[j];
-                xr = a[j1];
-                xi = a[j1 + 1];
-                yr = a[k1];
-                yi = a[k1 + 1];
-                a[j1] = yr;
-                a[j1 + 1] = yi;
-                a[k1] = xr;
-                a[k1 + 1] = xi;
-                j1 += m2;
-                k1 += 2 * m2;
-                xr = a[j1];
-                xi = a[j1 + 1];
-                yr = a[k1];
-                yi = a[k1 + 1];
-                a[j1] = yr;
-                a[j1 + 1] = yi;
-                a[k1] = xr;
-                a[k1 + 1] = xi;
-                j1 += m2;
-                k1 -= m2;
-                xr = a[j1];
-                xi = a[j1 + 1];
-                yr = a[k1];
-                yi = a[k1 + 1];
-                a[j1] = yr;
-                a[j1 + 1] = yi;
-                a[k1] = xr;
-                a[k1 + 1] = xi;
-                j1 += m2;
-                k1 += 2 * m2;
-                xr = a[j1];
-                xi = a[j1 + 1];
-                yr = a[k1];
-                yi = a[k1 + 1];
-                a[j1] = yr;
-                a[j1 + 1] = yi;
-                a[k1] = xr;
-                a[k1 + 1] = xi;
-            }
-            j1 = 2 * k + m2 + ip[k];
-            k1 = j1 + m2;
-            xr = a[j1];
-            xi = a[j1 + 1];
-            yr = a[k1];
-            yi = a[k1 + 1];
-            a[j1] = yr;
-            a[j1 + 1] = yi;
-            a[k1] = xr;
-            a[k1 + 1] = xi;
-        }
-    } else {
-        for (k = 1; k < m; k++) {
-            for (j = 0; j < k; j++) {
-                j1 = 2 * j + ip[k];
-                k1 = 2 * k + ip[j];
-                xr = a[j1];
-                xi = a[j1 + 1];
-                yr = a[k1];
-                yi = a[k1 + 1];
-                a[j1] = yr;
-                a[j1 + 1] = yi;
-                a[k1] = xr;
-                a[k1 + 1] = xi;
-                j1 += m2;
-                k1 += m2;
-                xr = a[j1];
-                xi = a[j1 + 1];
-                yr = a[k1];
-                yi = a[k1 + 1];
-                a[j1] = yr;
-                a[j1 + 1] = yi;
-                a[k1] = xr;
-                a[k1 + 1] = xi;
-            }
-        }
-    }
-}
-
-static void cftfsub(size_t n, float *a, float *w) {
-    size_t j, j1, j2, j3, l;
-    float x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;
-
-    l = 2;
-    if (n > 8) {
-        cft1st(n, a, w);
-        l = 8;
-        while ((l << 2) < n) {
-            cftmdl(n, l, a, w);
-            l <<= 2;
-        }
-    }
-    if ((l << 2) == n) {
-        for (j = 0; j < l; j += 2) {
-            j1 = j + l;
-            j2 = j1 + l;
-            j3 = j2 + l;
-            x0r = a[j] + a[j1];
-            x0i = a[j + 1] + a[j1 + 1];
-            x1r = a[j] - a[j1];
-            x1i = a[j + 1] - a[j1 + 1];
-            x2r = a[j2] + a[j3];
-            x2i = a[j2 + 1] + a[j3 + 1];
-            x3r = a[j2] - a[j3];
-            x3i = a[j2 + 1] - a[j3 + 1];
-            a[j] = x0r + x2r;
-            a[j + 1] = x0i + x2i;
-            a[j2] = x0r - x2r;
-            a[j2 + 1] = x0i - x2i;
-            a[j1] = x1r - x3i;
-            a[j1 + 1] = x1i + x3r;
-            a[j3] = x1r + x3i;
-            a[j3 + 1] = x1i - x3r;
-        }
-    } else {
-        for (j = 0; j < l; j += 2) {
-            j1 = j + l;
-            x0r = a[j] - a[j1];
-            x0i = a[j + 1] - a[j1 + 1];
-            a[j] += a[j1];
-            a[j + 1] += a[j1 + 1];
-            a[j1] = x0r;
-            a[j1 + 1] = x0i;
-        }
-    }
-}
-
-
-static void cftbsub(size_t n, float *a, float *w) {
-    size_t j, j1, j2, j3, l;
-    float x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;
-
-    l = 2;
-    if (n > 8) {
-        cft1st(n, a, w);
-        l = 8;
-        while ((l << 2) < n) {
-            cftmdl(n, l, a, w);
-            l <<= 2;
-        }
-    }
-    if ((l << 2) == n) {
-        for (j = 0; j < l; j += 2) {
-            j1 = j + l;
-            j2 = j1 + l;
-            j3 = j2 + l;
-            x0r = a[j] + a[j1];
-            x0i = -a[j + 1] - a[j1 + 1];
-            x1r = a[j] - a[j1];
-            x1i = -a[j + 1] + a[j1 + 1];
-            x2r = a[j2] + a[j3];
-            x2i = a[j2 + 1] + a[j3 + 1];
-            x3r = a[j2] - a[j3];
-            x3i = a[j2 + 1] - a[j3 + 1];
-            a[j] = x0r + x2r;
-            a[j + 1] = x0i - x2i;
-            a[j2] = x0r - x2r;
-            a[j2 + 1] = x0i + x2i;
-            a[j1] = x1r - x3i;
-            a[j1 + 1] = x1i - x3r;
-            a[j3] = x1r + x3i;
-            a[j3 + 1] = x1i + x3r;
-        }
-    } else {
-        for (j = 0; j < l; j += 2) {
-            j1 = j + l;
-            x0r = a[j] - a[j1];
-            x0i = -a[j + 1] + a[j1 + 1];
-            a[j] += a[j1];
-            a[j + 1] = -a[j + 1] - a[j1 + 1];
-            a[j1] = x0r;
-            a[j1 + 1] = x0i;
-        }
-    }
-}
-
-
-static void cft1st(size_t n, float *a, float *w) {
-    size_t j, k1, k2;
-    float wk1r, wk1i, wk2r, wk2i, wk3r, wk3i;
-    float x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;
-
-    x0r = a[0] + a[2];
-    x0i = a[1] + a[3];
-    x1r = a[0] - a[2];
-    x1i = a[1] - a[3];
-    x2r = a[4] + a[6];
-    x2i = a[5] + a[7];
-    x3r = a[4] - a[6];
-    x3i = a[5] - a[7];
-    a[0] = x0r + x2r;
-    a[1] = x0i + x2i;
-    a[4] = x0r - x2r;
-    a[5] = x0i - x2i;
-    a[2] = x1r - x3i;
-    a[3] = x1i + x3r;
-    a[6] = x1r + x3i;
-    a[7] = x1i - x3r;
-    wk1r = w[2];
-    x0r = a[8] + a[10];
-    x0i = a[9] + a[11];
-    x1r = a[8] - a[10];
-    x1i = a[9] - a[11];
-    x2r = a[12] + a[14];
-    x2i = a[13] + a[15];
-    x3r = a[12] - a[14];
-    x3i = a[13] - a[15];
-    a[8] = x0r + x2r;
-    a[9] = x0i + x2i;
-    a[12] = x2i - x0i;
-    a[13] = x0r - x2r;
-    x0r = x1r - x3i;
-    x0i = x1i + x3r;
-    a[10] = wk1r * (x0r - x0i);
-    a[11] = wk1r * (x0r + x0i);
-    x0r = x3i + x1r;
-    x0i = x3r - x1i;
-    a[14] = wk1r * (x0i - x0r);
-    a[15] = wk1r * (x0i + x0r);
-    k1 = 0;
-    for (j = 16; j < n; j += 16) {
-        k1 += 2;
-        k2 = 2 * k1;
-        wk2r = w[k1];
-        wk2i = w[k1 + 1];
-        wk1r = w[k2];
-        wk1i = w[k2 + 1];
-        wk3r = wk1r - 2 * wk2i * wk1i;
-        wk3i = 2 * wk2i * wk1r - wk1i;
-        x0r = a[j] + a[j + 2];
-        x0i = a[j + 1] + a[j + 3];
-        x1r = a[j] - a[j + 2];
-        x1i = a[j + 1] - a[j + 3];
-        x2r = a[j + 4] + a[j + 6];
-        x2i = a[j + 5] + a[j + 7];
-        x3r = a[j + 4] - a[j + 6];
-        x3i = a[j + 5] - a[j + 7];
-        a[j] = x0r + x2r;
-        a[j + 1] = x0i + x2i;
-        x0r -= x2r;
-        x0i -= x2i;
-        a[j + 4] = wk2r * x0r - wk2i * x0i;
-        a[j + 5] = wk2r * x0i + wk2i * x0r;
-        x0r = x1r - x3i;
-        x0i = x1i + x3r;
-        a[j + 2] = wk1r * x0r - wk1i * x0i;
-        a[j + 3] = wk1r * x0i + wk1i * x0r;
-        x0r = x1r + x3i;
-        x0i = x1i - x3r;
-        a[j + 6] = wk3r * x0r - wk3i * x0i;
-        a[j + 7] = wk3r * x0i + wk3i * x0r;
-        wk1r = w[k2 + 2];
-        wk1i = w[k2 + 3];
-        wk3r = wk1r - 2 * wk2r * wk1i;
-        wk3i = 2 * wk2r * wk1r - wk1i;
-        x0r = a[j + 8] + a[j + 10];
-        x0i = a[j + 9] + a[j + 11];
-        x1r = a[j + 8] - a[j + 10];
-        x1i = a[j + 9] - a[j + 11];
-        x2r = a[j + 12] + a[j + 14];
-        x2i = a[j + 13] + a[j + 15];
-        x3r = a[j + 12] - a[j + 14];
-        x3i = a[j + 13] - a[j + 15];
-        a[j + 8] = x0r + x2r;
-        a[j + 9] = x0i + x2i;
-        x0r -= x2r;
-        x0i -= x2i;
-        a[j + 12] = -wk2i * x0r - wk2r * x0i;
-        a[j + 13] = -wk2i * x0i + wk2r * x0r;
-        x0r = x1r - x3i;
-        x0i = x1i + x3r;
-        a[j + 10] = wk1r * x0r - wk1i * x0i;
-        a[j + 11] = wk1r * x0i + wk1i * x0r;
-        x0r = x1r + x3i;
-        x0i = x1i - x3r;
-        a[j + 14] = wk3r * x0r - wk3i * x0i;
-        a[j + 15] = wk3r * x0i + wk3i * x0r;
-    }
-}
-
-
-static void cftmdl(size_t n, size_t l, float *a, float *w) {
-    size_t j, j1, j2, j3, k, k1, k2, m, m2;
-    float wk1r, wk1i, wk2r, wk2i, wk3r, wk3i;
-    float x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;
-
-    m = l << 2;
-    for (j = 0; j < l; j += 2) {
-        j1 = j + l;
-        j2 = j1 + l;
-        j3 = j2 + l;
-        x0r = a[j] + a[j1];
-        x0i = a[j + 1] + a[j1 + 1];
-        x1r = a[j] - a[j1];
-        x1i = a[j + 1] - a[j1 + 1];
-        x2r = a[j2] + a[j3];
-        x2i = a[j2 + 1] + a[j3 + 1];
-        x3r = a[j2] - a[j3];
-        x3i = a[j2 + 1] - a[j3 + 1];
-        a[j] = x0r + x2r;
-        a[j + 1] = x0i + x2i;
-        a[j2] = x0r - x2r;
-        a[j2 + 1] = x0i - x2i;
-        a[j1] = x1r - x3i;
-        a[j1 + 1] = x1i + x3r;
-        a[j3] = x1r + x3i;
-        a[j3 + 1] = x1i - x3r;
-    }
-    wk1r = w[2];
-    for (j = m; j < l + m; j += 2) {
-        j1 = j + l;
-        j2 = j1 + l;
-        j3 = j2 + l;
-        x0r = a[j] + a[j1];
-        x0i = a[j + 1] + a[j1 + 1];
-        x1r = a[j] - a[j1];
-        x1i = a[j + 1] - a[j1 + 1];
-        x2r = a[j2] + a[j3];
-        x2i = a[j2 + 1] + a[j3 + 1];
-        x3r = a[j2] - a[j3];
-        x3i = a[j2 + 1] - a[j3 + 1];
-        a[j] = x0r + x2r;
-        a[j + 1] = x0i + x2i;
-        a[j2] = x2i - x0i;
-        a[j2 + 1] = x0r - x2r;
-        x0r = x1r - x3i;
-        x0i = x1i + x3r;
-        a[j1] = wk1r * (x0r - x0i);
-        a[j1 + 1] = wk1r * (x0r + x0i);
-        x0r = x3i + x1r;
-        x0i = x3r - x1i;
-        a[j3] = wk1r * (x0i - x0r);
-        a[j3 + 1] = wk1r * (x0i + x0r);
-    }
-    k1 = 0;
-    m2 = 2 * m;
-    for (k = m2; k < n; k += m2) {
-        k1 += 2;
-        k2 = 2 * k1;
-        wk2r = w[k1];
-        wk2i = w[k1 + 1];
-        wk1r = w[k2];
-        wk1i = w[k2 + 1];
-        wk3r = wk1r - 2 * wk2i * wk1i;
-        wk3i = 2 * wk2i * wk1r - wk1i;
-        for (j = k; j < l + k; j += 2) {
-            j1 = j + l;
-            j2 = j1 + l;
-            j3 = j2 + l;
-            x0r = a[j] + a[j1];
-            x0i = a[j + 1] + a[j1 + 1];
-            x1r = a[j] - a[j1];
-            x1i = a[j + 1] - a[j1 + 1];
-            x2r = a[j2] + a[j3];
-            x2i = a[j2 + 1] + a[j3 + 1];
-            x3r = a[j2] - a[j3];
-            x3i = a[j2 + 1] - a[j3 + 1];
-            a[j] = x0r + x2r;
-            a[j + 1] = x0i + x2i;
-            x0r -= x2r;
-            x0i -= x2i;
-            a[j2] = wk2r * x0r - wk2i * x0i;
-            a[j2 + 1] = wk2r * x0i + wk2i * x0r;
-            x0r = x1r - x3i;
-            x0i = x1i + x3r;
-            a[j1] = wk1r * x0r - wk1i * x0i;
-            a[j1 + 1] = wk1r * x0i + wk1i * x0r;
-            x0r = x1r + x3i;
-            x0i = x1i - x3r;
-            a[j3] = wk3r * x0r - wk3i * x0i;
-            a[j3 + 1] = wk3r * x0i + wk3i * x0r;
-        }
-        wk1r = w[k2 + 2];
-        wk1i = w[k2 + 3];
-        wk3r = wk1r - 2 * wk2r * wk1i;
-        wk3i = 2 * wk2r * wk1r - wk1i;
-        for (j = k + m; j < l + (k + m); j += 2) {
-            j1 = j + l;
-            j2 = j1 + l;
-            j3 = j2 + l;
-            x0r = a[j] + a[j1];
-            x0i = a[j + 1] + a[j1 + 1];
-            x1r = a[j] - a[j1];
-            x1i = a[j + 1] - a[j1 + 1];
-            x2r = a[j2] + a[j3];
-            x2i = a[j2 + 1] + a[j3 + 1];
-            x3r = a[j2] - a[j3];
-            x3i = a[j2 + 1] - a[j3 + 1];
-            a[j] = x0r + x2r;
-            a[j + 1] = x0i + x2i;
-            x0r -= x2r;
-            x0i -= x2i;
-            a[j2] = -wk2i * x0r - wk2r * x0i;
-            a[j2 + 1] = -wk2i * x0i + wk2r * x0r;
-            x0r = x1r - x3i;
-            x0i = x1i + x3r;
-            a[j1] = wk1r * x0r - wk1i * x0i;
-            a[j1 + 1] = wk1r * x0i + wk1i * x0r;
-            x0r = x1r + x3i;
-            x0i = x1i - x3r;
-            a[j3] = wk3r * x0r - wk3i * x0i;
-            a[j3 + 1] = wk3r * x0i + wk3i * x0r;
-        }
-    }
-}
-
-
-static void rftfsub(size_t n, float *a, size_t nc, float *c) {
-    size_t j, k, kk, ks, m;
-    float wkr, wki, xr, xi, yr, yi;
-
-    m = n >> 1;
-    ks = 2 * nc / m;
-    kk = 0;
-    for (j = 2; j < m; j += 2) {
-        k = n - j;
-        kk += ks;
-        wkr = 0.5f - c[nc - kk];
-        wki = c[kk];
-        xr = a[j] - a[k];
-        xi = a[j + 1] + a[k + 1];
-        yr = wkr * xr - wki * xi;
-        yi = wkr * xi + wki * xr;
-        a[j] -= yr;
-        a[j + 1] -= yi;
-        a[k] += yr;
-        a[k + 1] -= yi;
-    }
-}
-
-
-static void rftbsub(size_t n, float *a, size_t nc, float *c) {
-    size_t j, k, kk, ks, m;
-    float wkr, wki, xr, xi, yr, yi;
-
-    a[1] = -a[1];
-    m = n >> 1;
-    ks = 2 * nc / m;
-    kk = 0;
-    for (j = 2; j < m; j += 2) {
-        k = n - j;
-        kk += ks;
-        wkr = 0.5f - c[nc - kk];
-        wki = c[kk];
-        xr = a[j] - a[k];
-        xi = a[j + 1] + a[k + 1];
-        yr = wkr * xr + wki * xi;
-        yi = wkr * xi - wki * xr;
-        a[j] -= yr;
-        a[j + 1] = yi - a[j + 1];
-        a[k] += yr;
-        a[k + 1] = yi - a[k + 1];
-    }
-    a[m + 1] = -a[m + 1];
-}
-
-
 // Set Feature Extraction Parameters.
 static void set_feature_extraction_parameters(NoiseSuppressionC *self) {
     // Bin size of histogram.
@@ -780,11 +184,6 @@ int WebRtcNs_InitCore(NoiseSuppressionC *self, uint32_t fs) {
     }
     self->magnLen = self->anaLen / 2 + 1;  // Number of frequency bins.
     self->normMagnLen = 1.f / self->magnLen;
-    // Initialize FFT work arrays.
-    self->ip[0] = 0;  // Setting this triggers initialization.
-    memset(self->dataBuf, 0, sizeof(float) * ANAL_BLOCKL_MAX);
-    WebRtc_rdft(self->anaLen, 1, self->dataBuf, self->ip, self->wfft);
-
     memset(self->analyzeBuf, 0, sizeof(float) * ANAL_BLOCKL_MAX);
     memset(self->dataBuf, 0, sizeof(float) * ANAL_BLOCKL_MAX);
     memset(self->syntBuf, 0, sizeof(float) * ANAL_BLOCKL_MAX);
@@ -939,9 +338,8 @@ static void NoiseEstimation(NoiseSuppressionC *self,
         if (self->counter[s] >= END_STARTUP_LONG) {
             self->counter[s] = 0;
             if (self->updates >= END_STARTUP_LONG) {
-                for (i = 0; i < self->magnLen; i++) {
-                    self->quantile[i] = expf(self->lquantile[offset + i]);
-                }
+                self->kernels->approx_exp(self->lquantile + offset, 1.f,
+                                          self->quantile, self->magnLen);
             }
         }
 
@@ -951,9 +349,8 @@ static void NoiseEstimation(NoiseSuppressionC *self,
     // Sequentially update the noise during startup.
     if (self->updates < END_STARTUP_LONG) {
         // Use the last "s" to get noise during startup that differ from zero.
-        for (i = 0; i < self->magnLen; i++) {
-            self->quantile[i] = expf(self->lquantile[offset + i]);
-        }
+        self->kernels->approx_exp(self->lquantile + offset, 1.f,
+                                  self->quantile, self->magnLen);
         memcpy(noise, self->quantile, self->magnLen * sizeof(*noise));
     } else {
         memcpy(noise, self->quantile, self->magnLen * sizeof(*noise));
@@ -1259,8 +656,8 @@ static void ComputeSnr(const NoiseSuppressionC *self,
         // Directed decision update of snrPrior.
         snrLocPrior[i] = 2.f * (
                 DD_PR_SNR * previousEstimateStsa + (1.f - DD_PR_SNR) * snrLocPost[i]);
-        logSnrLocPrior[i] = log1pf(snrLocPrior[i]);
     }  // End of loop over frequencies.
+    self->kernels->approx_log1p(snrLocPrior, logSnrLocPrior, self->magnLen);
 }
 
 // Compute the difference measure between input spectrum and a template/learned
@@ -1409,9 +806,10 @@ static void SpeechNoiseProb(NoiseSuppressionC *self,
 
     // Final speech probability: combine prior model with LR factor:.
     gainPrior = (1.f - self->priorSpeechProb) / (self->priorSpeechProb + epsilon);
+    self->kernels->approx_exp(self->logLrtTimeAvg, -1.f, probSpeechFinal,
+                              self->magnLen);
     for (i = 0; i < self->magnLen; i++) {
-        invLrt = expf(-self->logLrtTimeAvg[i]);
-        invLrt = gainPrior * invLrt;
+        invLrt = gainPrior * probSpeechFinal[i];
         probSpeechFinal[i] = 1.f / (1.f + invLrt);
     }
 }
@@ -1561,7 +959,7 @@ static void FFT(NoiseSuppressionC *self,
 
     assert(magnitude_length == time_data_length / 2 + 1);
 
-    WebRtc_rdft(time_data_length, 1, time_data, self->ip, self->wfft);
+    self->kernels->rdft(time_data, time_data_length);
 
     imag[0] = 0;
     real[0] = time_data[0];
@@ -1569,34 +967,20 @@ static void FFT(NoiseSuppressionC *self,
     imag[magnitude_length - 1] = 0;
     real[magnitude_length - 1] = time_data[1];
     magn[magnitude_length - 1] = fabsf(real[magnitude_length - 1]);
-    float *time_data_ptr = time_data + 2;
+    float energy[HALF_ANAL_BLOCKL];
+    self->kernels->magnitude(time_data, real, imag, energy, magn,
+                             magnitude_length - 2);
     if (prev_calc == 1) {
         float first = real[0] * real[0] + imag[0] * imag[0];
         float last = real[magnitude_length - 1] * real[magnitude_length - 1] +
                      imag[magnitude_length - 1] * imag[magnitude_length - 1];
         *signalEnergy = first + last;
         *sumMagn = sqrtf(first + epsilon_squ) + 2.f + sqrtf(last + epsilon_squ);
-        lmagn[0] = log1pf(magn[0]);
-        lmagn[magnitude_length - 1] = log1pf(magn[magnitude_length - 1]);
         for (i = 1; i < magnitude_length - 1; ++i) {
-            real[i] = time_data_ptr[0];
-            imag[i] = time_data_ptr[1];
-            const float energy = real[i] * real[i] + imag[i] * imag[i];
-            *signalEnergy += energy;
-            // Magnitude spectrum.
-            magn[i] = sqrtf(energy + epsilon_squ);
+            *signalEnergy += energy[i];
             *sumMagn += magn[i];
-            lmagn[i] = log1pf(magn[i]);
-            time_data_ptr += 2;
-        }
-    } else {
-        for (i = 1; i < magnitude_length - 1; ++i) {
-            real[i] = time_data_ptr[0];
-            imag[i] = time_data_ptr[1];
-            // Magnitude spectrum.
-            magn[i] = sqrtf(real[i] * real[i] + imag[i] * imag[i] + epsilon_squ);
-            time_data_ptr += 2;
         }
+        self->kernels->approx_log1p(magn, lmagn, magnitude_length);
     }
 }
 
@@ -1628,21 +1012,22 @@ static void IFFT(NoiseSuppressionC *self,
         time_data_ptr[1] = imag[i];
         time_data_ptr += 2;
     }
-    WebRtc_rdft(time_data_length, -1, time_data, self->ip, self->wfft);
+    self->kernels->inverse_rdft(time_data, time_data_length);
     float norm = 2.f / time_data_length;
     for (i = 0; i < time_data_length; ++i) {
         time_data[i] *= norm;  // FFT scaling.
     }
 }
 
-static float WindowingEnergy(const float *window,
+static float WindowingEnergy(const NsKernels *kernels,
+                             const float *window,
                              const float *data,
                              size_t length,
                              float *data_windowed) {
     size_t i;
     float energy = 0.f;
+    kernels->multiply(window, data, data_windowed, length);
     for (i = 0; i < length; ++i) {
-        data_windowed[i] = window[i] * data[i];
         energy += data_windowed[i] * data_windowed[i];
     }
     return energy;
@@ -1673,24 +1058,12 @@ static float Energy(const float *buffer, size_t length) {
 static void ComputeDdBasedWienerFilter(const NoiseSuppressionC *self,
                                        const float *magn,
                                        float *theFilter) {
-    size_t i;
-    float snrPrior, previousEstimateStsa, currentEstimateStsa;
-
-    for (i = 0; i < self->magnLen; i++) {
-        // Previous estimate: based on previous frame with gain filter.
-        previousEstimateStsa = self->magnPrevProcess[i] * self->smooth[i] / (self->noisePrev[i] + epsilon);
-        // Post and prior SNR.
-        currentEstimateStsa = 0.f;
-        if (magn[i] > self->noise[i]) {
-            currentEstimateStsa = (magn[i] - self->noise[i]) / (self->noise[i] + epsilon);
-        }
-        // DD estimate is sum of two terms: current estimate and previous estimate.
-        // Directed decision update of |snrPrior|.
-        snrPrior = DD_PR_SNR * previousEstimateStsa +
-                   (1.f - DD_PR_SNR) * currentEstimateStsa;
-        // Gain filter.
-        theFilter[i] = snrPrior / (self->overdrive + snrPrior);
-    }  // End of loop over frequencies.
+    // The previous estimate is based on the previous frame with the gain
+    // filter, the current one on the post SNR; their decision-directed sum
+    // gives the prior SNR and the gain filter.
+    self->kernels->wiener_filter(magn, self->magnPrevProcess, self->smooth,
+                                 self->noise, self->noisePrev, self->overdrive,
+                                 theFilter, self->magnLen);
 }
 
 // Changes the aggressiveness of the noise suppression method.
@@ -1725,19 +1098,19 @@ int WebRtcNs_set_policy_core(NoiseSuppressionC *self, int mode) {
     return 0;
 }
 
-void WebRtcNs_AnalyzeCore(NoiseSuppressionC *self, const int16_t *speechFrame) {
+// Updates the noise estimate and speech probability from the spectrum of a
+// frame with nonzero energy.
+static void AnalyzeSpectrum(NoiseSuppressionC *self,
+                            const float *magn,
+                            float *lmagn,
+                            float signalEnergy,
+                            float sumMagn) {
     size_t i;
     const size_t kStartBand = 5;  // Skip first frequency bins during estimation.
-    int updateParsFlag;
-    float energy;
-    float signalEnergy = 0.f;
-    float sumMagn = 0.f;
+    const int updateParsFlag = self->modelUpdatePars[0];
     float tmpFloat1, tmpFloat2, tmpFloat3;
-    float winData[ANAL_BLOCKL_MAX];
-    float lmagn[HALF_ANAL_BLOCKL];
-    float magn[HALF_ANAL_BLOCKL], noise[HALF_ANAL_BLOCKL];
+    float noise[HALF_ANAL_BLOCKL];
     float snrLocPost[HALF_ANAL_BLOCKL], snrLocPrior[HALF_ANAL_BLOCKL], logSnrLocPrior[HALF_ANAL_BLOCKL];
-    float real[ANAL_BLOCKL_MAX], imag[HALF_ANAL_BLOCKL];
     // Variables during startup.
     float sum_log_i = 0;
     float sum_log_i_square = 0;
@@ -1746,28 +1119,6 @@ void WebRtcNs_AnalyzeCore(NoiseSuppressionC *self, const int16_t *speechFrame) {
     float parametric_exp = 0;
     float parametric_num = 0;
 
-    // Check that initiation has been done.
-    assert(1 == self->initFlag);
-    updateParsFlag = self->modelUpdatePars[0];
-
-    // Update analysis buffer for L band.
-    UpdateBuffer(speechFrame, self->blockLen, self->anaLen, self->analyzeBuf);
-    energy = WindowingEnergy(self->window, self->analyzeBuf, self->anaLen, winData);
-    if (energy == 0.0) {
-        // We want to avoid updating statistics in this case:
-        // Updating feature statistics when we have zeros only will cause
-        // thresholds to move towards zero signal situations. This in turn has the
-        // effect that once the signal is "turned on" (non-zero values) everything
-        // will be treated as speech and there is no noise suppression effect.
-        // Depending on the duration of the inactive signal it takes a
-        // considerable amount of time for the system to learn what is noise and
-        // what is speech.
-        return;
-    }
-
-    self->blockInd++;  // Update the block index only when we process a block.
-
-    FFT(self, winData, self->anaLen, self->magnLen, real, imag, magn, lmagn, 1, &signalEnergy, &sumMagn);
     if (self->blockInd < END_STARTUP_SHORT) {
         for (i = kStartBand; i < self->magnLen; i++) {
             sum_log_i += self->log_lut[i];
@@ -1827,12 +1178,19 @@ void WebRtcNs_AnalyzeCore(NoiseSuppressionC *self, const int16_t *speechFrame) {
             parametric_num = expf(self->pinkNoiseNumerator * norm);
             parametric_num *= (float) (self->blockInd + 1);
             parametric_exp = self->pinkNoiseExp * norm;
+            // use_band^-parametric_exp as exp(-parametric_exp * log(use_band)),
+            // with log(use_band) = log_lut[use_band - 1].
+            float log_band[HALF_ANAL_BLOCKL];
+            for (i = 0; i < self->magnLen; i++) {
+                log_band[i] = self->log_lut[(i < kStartBand ? kStartBand : i) - 1];
+            }
+            self->kernels->approx_exp(log_band, -parametric_exp,
+                                      self->parametricNoise, self->magnLen);
             for (i = 0; i < self->magnLen; i++) {
                 // Estimate the background noise using the white and pink noise
                 // parameters.
                 // Use pink noise estimate.
-                float use_band = (float) (i < kStartBand ? kStartBand : i);
-                self->parametricNoise[i] = parametric_num / powf(use_band, parametric_exp);
+                self->parametricNoise[i] *= parametric_num;
                 // Weight quantile noise with modeled noise.
                 noise[i] *= (self->blockInd);
                 tmpFloat2 = self->parametricNoise[i] * (END_STARTUP_SHORT - self->blockInd);
@@ -1861,87 +1219,71 @@ void WebRtcNs_AnalyzeCore(NoiseSuppressionC *self, const int16_t *speechFrame) {
     memcpy(self->magnPrevAnalyze, magn, sizeof(*magn) * self->magnLen);
 }
 
-void WebRtcNs_ProcessCore(NoiseSuppressionC *self,
-                          const int16_t *const *speechFrame,
-                          size_t num_bands,
-                          int16_t *const *outFrame) {
-    // Main routine for noise reduction.
-    int flagHB = 0;
-    size_t i, j;
-
-    float energy1, energy2, gain, factor, factor1, factor2;
-    float fout[BLOCKL_MAX];
+void WebRtcNs_AnalyzeCore(NoiseSuppressionC *self, const int16_t *speechFrame) {
+    float energy;
+    float signalEnergy = 0.f;
+    float sumMagn = 0.f;
     float winData[ANAL_BLOCKL_MAX];
+    float lmagn[HALF_ANAL_BLOCKL];
     float magn[HALF_ANAL_BLOCKL];
-    float theFilter[HALF_ANAL_BLOCKL], theFilterTmp[HALF_ANAL_BLOCKL];
     float real[ANAL_BLOCKL_MAX], imag[HALF_ANAL_BLOCKL];
-    float norm_end = 1.f / END_STARTUP_SHORT;
-    // SWB variables.
-    int deltaBweHB = 1;
-    int deltaGainHB = 1;
-    float decayBweHB = 1;
-    float gainMapParHB = 1;
-    float avgProbSpeechHB, avgProbSpeechHBTmp, avgFilterGainHB, gainModHB;
-    float sumMagnAnalyze, sumMagnProcess;
 
     // Check that initiation has been done.
     assert(1 == self->initFlag);
-    assert(num_bands - 1 <= NUM_HIGH_BANDS_MAX);
-
-    const int16_t *const *speechFrameHB = NULL;
-    int16_t *const *outFrameHB = NULL;
-    size_t num_high_bands = 0;
-    if (num_bands > 1) {
-        speechFrameHB = &speechFrame[1];
-        outFrameHB = &outFrame[1];
-        num_high_bands = num_bands - 1;
-        flagHB = 1;
-        // Range for averaging low band quantities for H band gain.
-        deltaBweHB = (int) self->magnLen / 4;
-        deltaGainHB = deltaBweHB;
-    }
 
     // Update analysis buffer for L band.
-    UpdateBuffer(speechFrame[0], self->blockLen, self->anaLen, self->dataBuf);
-
-    if (flagHB == 1) {
-        // Update analysis buffer for H bands.
-        for (i = 0; i < num_high_bands; ++i) {
-            UpdateBuffer(speechFrameHB[i],
-                         self->blockLen,
-                         self->anaLen,
-                         self->dataBufHB[i]);
-        }
+    UpdateBuffer(speechFrame, self->blockLen, self->anaLen, self->analyzeBuf);
+    energy = WindowingEnergy(self->kernels, self->window, self->analyzeBuf,
+                             self->anaLen, winData);
+    if (energy == 0.0) {
+        // We want to avoid updating statistics in this case:
+        // Updating feature statistics when we have zeros only will cause
+        // thresholds to move towards zero signal situations. This in turn has the
+        // effect that once the signal is "turned on" (non-zero values) everything
+        // will be treated as speech and there is no noise suppression effect.
+        // Depending on the duration of the inactive signal it takes a
+        // considerable amount of time for the system to learn what is noise and
+        // what is speech.
+        return;
     }
-    energy1 = WindowingEnergy(self->window, self->dataBuf, self->anaLen, winData);
-    if (energy1 == 0.0) {
-        // Synthesize the special case of zero input.
-        // Read out fully processed segment.
-        for (i = self->windShift; i < self->blockLen + self->windShift; i++) {
-            fout[i - self->windShift] = self->syntBuf[i];
-        }
-        // Update synthesis buffer.
-        UpdateBuffer(NULL, self->blockLen, self->anaLen, self->syntBuf);
 
-        for (i = 0; i < self->blockLen; ++i)
-            outFrame[0][i] =
-                    SPL_SAT(32767, fout[i], (-32768));
+    self->blockInd++;  // Update the block index only when we process a block.
 
-        // For time-domain gain of HB.
-        if (flagHB == 1) {
-            for (i = 0; i < num_high_bands; ++i) {
-                for (j = 0; j < self->blockLen; ++j) {
-                    outFrameHB[i][j] = SPL_SAT(32767,
-                                               self->dataBufHB[i][j],
-                                               (-32768));
-                }
-            }
-        }
+    FFT(self, winData, self->anaLen, self->magnLen, real, imag, magn, lmagn, 1, &signalEnergy, &sumMagn);
+    AnalyzeSpectrum(self, magn, lmagn, signalEnergy, sumMagn);
+}
 
-        return;
+// Moves the next finished block out of the synthesis buffer.
+static void ReadOutBlock(NoiseSuppressionC *self, int16_t *out) {
+    size_t i;
+    float fout[BLOCKL_MAX];
+
+    // Read out fully processed segment.
+    for (i = self->windShift; i < self->blockLen + self->windShift; i++) {
+        fout[i - self->windShift] = self->syntBuf[i];
     }
+    // Update synthesis buffer.
+    UpdateBuffer(NULL, self->blockLen, self->anaLen, self->syntBuf);
 
-    FFT(self, winData, self->anaLen, self->magnLen, real, imag, magn, NULL, 0, NULL, NULL);
+    for (i = 0; i < self->blockLen; ++i)
+        out[i] =
+                SPL_SAT(32767, fout[i], (-32768));
+}
+
+// Applies the Wiener filter to the spectrum of a windowed frame with energy
+// energy1, overlap-adds it into the synthesis buffer and reads out the low
+// band block. winData is reused for the inverse transform.
+static void SuppressSpectrum(NoiseSuppressionC *self,
+                             float energy1,
+                             float *winData,
+                             float *real,
+                             float *imag,
+                             const float *magn,
+                             int16_t *out) {
+    size_t i;
+    float energy2, gain, factor, factor1, factor2;
+    float theFilter[HALF_ANAL_BLOCKL], theFilterTmp[HALF_ANAL_BLOCKL];
+    float norm_end = 1.f / END_STARTUP_SHORT;
 
     if (self->blockInd < END_STARTUP_SHORT) {
         for (i = 0; i < self->magnLen; i++) {
@@ -1971,21 +1313,9 @@ void WebRtcNs_ProcessCore(NoiseSuppressionC *self,
             imag[i] *= self->smooth[i];
         }
     } else {
-        for (i = 0; i < self->magnLen; i++) {
-            // Flooring bottom.
-            if (theFilter[i] < self->denoiseBound) {
-                theFilter[i] = self->denoiseBound;
-            }
-            // Flooring top.
-            if (theFilter[i] > 1.f) {
-                theFilter[i] = 1.f;
-                self->smooth[i] = theFilter[i];
-            } else {
-                self->smooth[i] = theFilter[i];
-                real[i] *= self->smooth[i];
-                imag[i] *= self->smooth[i];
-            }
-        }
+        // Floor the filter to [denoiseBound, 1] and apply it.
+        self->kernels->apply_filter(theFilter, self->smooth, real, imag,
+                                    self->denoiseBound, self->magnLen);
     }
     // Keep track of |magn| spectrum for next frame.
     memcpy(self->magnPrevProcess, magn, sizeof(*magn) * self->magnLen);
@@ -2024,19 +1354,83 @@ void WebRtcNs_ProcessCore(NoiseSuppressionC *self,
     }  // Out of self->gainmap == 1.
 
     // Synthesis.
-    for (i = 0; i < self->anaLen; i++) {
-        self->syntBuf[i] += factor * winData[i] * self->window[i];
+    self->kernels->synthesize(self->syntBuf, winData, self->window, factor,
+                              self->anaLen);
+    ReadOutBlock(self, out);
+}
+
+void WebRtcNs_ProcessCore(NoiseSuppressionC *self,
+                          const int16_t *const *speechFrame,
+                          size_t num_bands,
+                          int16_t *const *outFrame) {
+    // Main routine for noise reduction.
+    int flagHB = 0;
+    size_t i, j;
+
+    float energy1;
+    float winData[ANAL_BLOCKL_MAX];
+    float magn[HALF_ANAL_BLOCKL];
+    float real[ANAL_BLOCKL_MAX], imag[HALF_ANAL_BLOCKL];
+    // SWB variables.
+    int deltaBweHB = 1;
+    int deltaGainHB = 1;
+    float decayBweHB = 1;
+    float gainMapParHB = 1;
+    float avgProbSpeechHB, avgProbSpeechHBTmp, avgFilterGainHB, gainModHB;
+    float sumMagnAnalyze, sumMagnProcess;
+
+    // Check that initiation has been done.
+    assert(1 == self->initFlag);
+    assert(num_bands - 1 <= NUM_HIGH_BANDS_MAX);
+
+    const int16_t *const *speechFrameHB = NULL;
+    int16_t *const *outFrameHB = NULL;
+    size_t num_high_bands = 0;
+    if (num_bands > 1) {
+        speechFrameHB = &speechFrame[1];
+        outFrameHB = &outFrame[1];
+        num_high_bands = num_bands - 1;
+        flagHB = 1;
+        // Range for averaging low band quantities for H band gain.
+        deltaBweHB = (int) self->magnLen / 4;
+        deltaGainHB = deltaBweHB;
     }
-    // Read out fully processed segment.
-    for (i = self->windShift; i < self->blockLen + self->windShift; i++) {
-        fout[i - self->windShift] = self->syntBuf[i];
+
+    // Update analysis buffer for L band.
+    UpdateBuffer(speechFrame[0], self->blockLen, self->anaLen, self->dataBuf);
+
+    if (flagHB == 1) {
+        // Update analysis buffer for H bands.
+        for (i = 0; i < num_high_bands; ++i) {
+            UpdateBuffer(speechFrameHB[i],
+                         self->blockLen,
+                         self->anaLen,
+                         self->dataBufHB[i]);
+        }
     }
-    // Update synthesis buffer.
-    UpdateBuffer(NULL, self->blockLen, self->anaLen, self->syntBuf);
+    energy1 = WindowingEnergy(self->kernels, self->window, self->dataBuf,
+                              self->anaLen, winData);
+    if (energy1 == 0.0) {
+        // Synthesize the special case of zero input.
+        ReadOutBlock(self, outFrame[0]);
 
-    for (i = 0; i < self->blockLen; ++i)
-        outFrame[0][i] =
-                SPL_SAT(32767, fout[i], (-32768));
+        // For time-domain gain of HB.
+        if (flagHB == 1) {
+            for (i = 0; i < num_high_bands; ++i) {
+                for (j = 0; j < self->blockLen; ++j) {
+                    outFrameHB[i][j] = SPL_SAT(32767,
+                                               self->dataBufHB[i][j],
+                                               (-32768));
+                }
+            }
+        }
+
+        return;
+    }
+
+    FFT(self, winData, self->anaLen, self->magnLen, real, imag, magn, NULL, 0, NULL, NULL);
+
+    SuppressSpectrum(self, energy1, winData, real, imag, magn, outFrame[0]);
 
     // For time-domain gain of HB.
     if (flagHB == 1) {
@@ -2094,10 +1488,47 @@ void WebRtcNs_ProcessCore(NoiseSuppressionC *self,
     }  // End of H band gain computation.
 }
 
+void WebRtcNs_AnalyzeProcessCore(NoiseSuppressionC *self,
+                                 const int16_t *speechFrame,
+                                 int16_t *outFrame) {
+    float energy;
+    float signalEnergy = 0.f;
+    float sumMagn = 0.f;
+    float winData[ANAL_BLOCKL_MAX];
+    float lmagn[HALF_ANAL_BLOCKL];
+    float magn[HALF_ANAL_BLOCKL];
+    float real[ANAL_BLOCKL_MAX], imag[HALF_ANAL_BLOCKL];
+
+    // Check that initiation has been done.
+    assert(1 == self->initFlag);
+
+    // Both buffers hold the same samples in single band use; keep them in
+    // step so the separate entry points can still be used afterwards.
+    UpdateBuffer(speechFrame, self->blockLen, self->anaLen, self->analyzeBuf);
+    UpdateBuffer(speechFrame, self->blockLen, self->anaLen, self->dataBuf);
+    energy = WindowingEnergy(self->kernels, self->window, self->analyzeBuf,
+                             self->anaLen, winData);
+    if (energy == 0.0) {
+        // Skip the statistics update as in WebRtcNs_AnalyzeCore and
+        // synthesize the zero input case as in WebRtcNs_ProcessCore.
+        ReadOutBlock(self, outFrame);
+        return;
+    }
+
+    self->blockInd++;  // Update the block index only when we process a block.
+
+    // One windowing and forward transform serve both halves; the analysis
+    // leaves real, imag and magn untouched for the filter.
+    FFT(self, winData, self->anaLen, self->magnLen, real, imag, magn, lmagn, 1, &signalEnergy, &sumMagn);
+    AnalyzeSpectrum(self, magn, lmagn, signalEnergy, sumMagn);
+    SuppressSpectrum(self, energy, winData, real, imag, magn, outFrame);
+}
+
 NsHandle *WebRtcNs_Create() {
     NoiseSuppressionC *self = (NoiseSuppressionC *) malloc(sizeof(NoiseSuppressionC));
     if (self != NULL) {
         self->initFlag = 0;
+        self->kernels = NsKernelsSelect();
     }
     return (NsHandle *) self;
 }
@@ -2116,15 +1547,28 @@ int WebRtcNs_set_policy(NsHandle *NS_inst, int mode) {
 }
 
 void WebRtcNs_Analyze(NsHandle *NS_inst, const int16_t *spframe) {
+    TRACE_BEGIN("ns.analyze");
     WebRtcNs_AnalyzeCore((NoiseSuppressionC *) NS_inst, spframe);
+    TRACE_END();
 }
 
 void WebRtcNs_Process(NsHandle *NS_inst,
                       const int16_t *const *spframe,
                       size_t num_bands,
                       int16_t *const *outframe) {
+    TRACE_BEGIN("ns.process");
     WebRtcNs_ProcessCore((NoiseSuppressionC *) NS_inst, spframe, num_bands,
                          outframe);
+    TRACE_END();
+}
+
+void WebRtcNs_AnalyzeProcess(NsHandle *NS_inst,
+                             const int16_t *spframe,
+                             int16_t *outframe) {
+    TRACE_BEGIN("ns.analyze_process");
+    WebRtcNs_AnalyzeProcessCore((NoiseSuppressionC *) NS_inst, spframe,
+                                outframe);
+    TRACE_END();
 }
 
 float WebRtcNs_prior_speech_probability(NsHandle *handle) {
@@ -2149,3 +1593,14 @@ const float *WebRtcNs_noise_estimate(const NsHandle *handle) {
 size_t WebRtcNs_num_freq() {
     return HALF_ANAL_BLOCKL;
 }
+
+void WebRtcNs_set_kernels(NsHandle *handle, const NsKernels *kernels) {
+    ((NoiseSuppressionC *) handle)->kernels = kernels;
+}
+
+const NsKernels *WebRtcNs_kernels(const NsHandle *handle) {
+    if (handle == NULL) {
+        return NULL;
+    }
+    return ((const NoiseSuppressionC *) handle)->kernels;
+}
@@ -26,10 +26,6 @@
 #define FACTOR              (float)40.0
 #define WIDTH               (float)0.01
 
-// Length of fft work arrays.
-#define IP_LENGTH (ANAL_BLOCKL_MAX >> 1) // must be at least ceil(2 + sqrt(ANAL_BLOCKL_MAX/2))
-#define W_LENGTH (ANAL_BLOCKL_MAX >> 1)
-
 //PARAMETERS FOR NEW METHOD
 #define DD_PR_SNR           (float)0.98 // DD update of prior SNR
 #define LRT_TAVG            (float)0.50 // tavg parameter for LRT (previously 0.90)
@@ -51,6 +47,8 @@
 
 #include <assert.h>
 
+#include "ns_kernels.h"
+
 
 typedef struct NsHandleT NsHandle;
 
@@ -121,9 +119,6 @@ typedef struct NoiseSuppressionC_ {
     float overdrive;
     float denoiseBound;
     int gainmap;
-    // FFT work arrays.
-    size_t ip[IP_LENGTH];
-    float wfft[W_LENGTH];
 
     // Parameters for new method: some not needed, will reduce/cleanup later.
     int32_t blockInd;  // Frame index counter.
@@ -158,12 +153,11 @@ typedef struct NoiseSuppressionC_ {
     float speechProb[HALF_ANAL_BLOCKL];  // Final speech/noise prob: prior + LRT.
     // Buffering data for HB.
     float dataBufHB[NUM_HIGH_BANDS_MAX][ANAL_BLOCKL_MAX];
+    // Spectral loops for this CPU, chosen by WebRtcNs_Create.
+    const NsKernels *kernels;
 
 } NoiseSuppressionC;
 
-// Refer to fft4g.c for documentation.
-void WebRtc_rdft(size_t n, int isgn, float *a, size_t *ip, float *w);
-
 /****************************************************************************
  * WebRtcNs_InitCore(...)
  *
@@ -231,6 +225,25 @@ void WebRtcNs_ProcessCore(NoiseSuppressionC *self,
                           size_t num_bands,
                           int16_t *const *outFrame);
 
+/****************************************************************************
+ * WebRtcNs_AnalyzeProcessCore
+ *
+ * WebRtcNs_AnalyzeCore followed by single band WebRtcNs_ProcessCore on the
+ * same frame, windowing and transforming it once for both. The output is
+ * identical to the two separate calls.
+ *
+ * Input:
+ *      - self          : Instance that should be initialized
+ *      - speechFrame   : Input speech frame for lower band
+ *
+ * Output:
+ *      - self          : Updated instance
+ *      - outFrame      : Output speech frame, may alias speechFrame
+ */
+void WebRtcNs_AnalyzeProcessCore(NoiseSuppressionC *self,
+                                 const int16_t *speechFrame,
+                                 int16_t *outFrame);
+
 /*
  * This function creates an instance of the floating point Noise Suppression.
  */
@@ -307,6 +320,22 @@ void WebRtcNs_Process(NsHandle *NS_inst,
                       size_t num_bands,
                       int16_t *const *outframe);
 
+/*
+ * Same as WebRtcNs_Analyze followed by WebRtcNs_Process with one band, but
+ * windows and transforms the frame once instead of twice.
+ *
+ * Input
+ *      - NS_inst       : Noise suppression instance.
+ *      - spframe       : Pointer to speech frame buffer for L band
+ *
+ * Output:
+ *      - NS_inst       : Updated NS instance
+ *      - outframe      : Pointer to output frame, may be spframe
+ */
+void WebRtcNs_AnalyzeProcess(NsHandle *NS_inst,
+                             const int16_t *spframe,
+                             int16_t *outframe);
+
 /* Returns the internally used prior speech probability of the current frame.
  * There is a frequency bin based one as well, with which this should not be
  * confused.
@@ -338,6 +367,24 @@ const float *WebRtcNs_noise_estimate(const NsHandle *handle);
  */
 size_t WebRtcNs_num_freq();
 
+/* Replaces the kernels chosen for the CPU by WebRtcNs_Create, for tests and
+ * benchmarks comparing the variants. They must be supported by the CPU.
+ *
+ * Input
+ *      - handle        : Noise suppression instance.
+ *      - kernels       : One of the NsKernelsVariant tables.
+ */
+void WebRtcNs_set_kernels(NsHandle *handle, const NsKernels *kernels);
+
+/* Returns the kernels the instance runs with.
+ *
+ * Input
+ *      - handle        : Noise suppression instance.
+ *
+ * Return value         : The kernels, NULL if the input is a NULL pointer.
+ */
+const NsKernels *WebRtcNs_kernels(const NsHandle *handle);
+
 #ifdef __cplusplus
 }
 #endif
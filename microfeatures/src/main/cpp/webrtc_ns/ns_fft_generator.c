@@ -0,0 +1,79 @@
+#include <math.h>
+#include <stdio.h>
+
+// Writes the twiddle tables used by ns_fft_kernels.h. The values are
+// computed in double precision and rounded once to float, so every variant
+// and every instance of the noise suppressor shares the same constants.
+
+#define kLargestPass 128
+#define kLargestRealLength 256
+
+static const double kPi =
+        3.141592653589793238462643383279502884197169399375105820974944;
+
+static void WriteValue(FILE *fp, double value, int *count) {
+    if (*count % 4 == 0) {
+        fprintf(fp, "\n       ");
+    }
+    fprintf(fp, " %.9ef,", (float) value);
+    ++*count;
+}
+
+// cos(2 pi power k / n) for k in [0, length), then the sines.
+static void WriteTwiddles(FILE *fp, int n, int length, int power) {
+    int count = 0;
+    int k;
+    for (k = 0; k < length; ++k) {
+        WriteValue(fp, cos(2 * kPi * power * k / n), &count);
+    }
+    for (k = 0; k < length; ++k) {
+        WriteValue(fp, sin(2 * kPi * power * k / n), &count);
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr,
+                "%s requires exactly one parameter - the name of the header "
+                "to save\n",
+                argv[0]);
+        return 1;
+    }
+    FILE *fp = fopen(argv[1], "w");
+    if (!fp) {
+        fprintf(stderr, "Failed to open header '%s' for write\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(fp, "// Generated by ns_fft_generator.c, do not edit.\n");
+    fprintf(fp,
+            "#ifndef WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_FFT_TABLES_H_\n");
+    fprintf(fp,
+            "#define WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_FFT_TABLES_H_\n\n");
+
+    // For the radix-4 pass over n points, from 128 down to 4: the real and
+    // imaginary parts of w^p, w^2p and w^3p for p in [0, n / 4), each run
+    // contiguous. The pass over n points starts at 6 * (64 - n / 2).
+    fprintf(fp, "static const float kNsFftPassTwiddles[] = {");
+    int n;
+    for (n = kLargestPass; n >= 4; n /= 2) {
+        int power;
+        for (power = 1; power <= 3; ++power) {
+            WriteTwiddles(fp, n, n / 4, power);
+        }
+    }
+    fprintf(fp, "\n};\n\n");
+
+    // The twiddles of the real split of 256 and 128 points, cosines of
+    // k in [0, n / 4) followed by the sines.
+    for (n = kLargestRealLength; n >= kLargestRealLength / 2; n /= 2) {
+        fprintf(fp, "static const float kNsFftSplitTwiddles%d[] = {", n);
+        WriteTwiddles(fp, n, n / 4, 1);
+        fprintf(fp, "\n};\n\n");
+    }
+
+    fprintf(fp,
+            "#endif  // WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_FFT_TABLES_H_\n");
+    fclose(fp);
+    return 0;
+}
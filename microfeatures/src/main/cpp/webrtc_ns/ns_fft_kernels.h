@@ -0,0 +1,484 @@
+/*
+ * The real FFT of the noise suppressor, with the packing and scaling of
+ * Ooura's rdft in fft4g.c: the forward transform leaves R[0] in a[0],
+ * R[n / 2] in a[1] and R[k], I[k] in a[2k], a[2k + 1], where
+ * I[k] = sum_j a[j] sin(2 pi j k / n), and the inverse returns n / 2 times
+ * the signal. The n real points are transformed as n / 2 complex ones by
+ * Stockham radix-4 passes over split real and imaginary arrays, then split
+ * into the real spectrum. Only n = 128 and n = 256 are supported.
+ *
+ * Included by ns_kernels_variant.h. The vector loops compute every output
+ * with the same operations as the scalar tails, so with multiplies and adds
+ * left uncontracted all variants give identical bits.
+ */
+#ifndef WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_FFT_KERNELS_H_
+#define WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_FFT_KERNELS_H_
+
+#include <stddef.h>
+
+#include "ns_fft_tables.h"
+
+#if defined(NS_KERNELS_SCALAR)
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define NS_FFT_NEON 1
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define NS_FFT_SSE4_1 1
+#endif
+
+// Complex points of the 256 point real transform.
+#define kNsFftMaxComplexSize 128
+
+// Twiddles of the radix-4 pass over n points in kNsFftPassTwiddles.
+#define NS_FFT_PASS_TWIDDLES(n) (kNsFftPassTwiddles + 6 * (64 - (n) / 2))
+
+// Radix-4 butterfly of a, b, c, d spaced in_stride apart. Outputs 1 to 3 are
+// rotated by w^p, w^2p and w^3p, read from w[0], w[2m] and w[4m] with their
+// imaginary parts m further on, and stored out_stride apart.
+static inline void NsFftButterfly(const float *xr,
+                                  const float *xi,
+                                  size_t in_stride,
+                                  float *yr,
+                                  float *yi,
+                                  size_t out_stride,
+                                  const float *w,
+                                  size_t m) {
+    const float apc_r = xr[0] + xr[2 * in_stride];
+    const float apc_i = xi[0] + xi[2 * in_stride];
+    const float amc_r = xr[0] - xr[2 * in_stride];
+    const float amc_i = xi[0] - xi[2 * in_stride];
+    const float bpd_r = xr[in_stride] + xr[3 * in_stride];
+    const float bpd_i = xi[in_stride] + xi[3 * in_stride];
+    const float bmd_r = xr[in_stride] - xr[3 * in_stride];
+    const float bmd_i = xi[in_stride] - xi[3 * in_stride];
+    const float t1_r = amc_r - bmd_i;
+    const float t1_i = amc_i + bmd_r;
+    const float t2_r = apc_r - bpd_r;
+    const float t2_i = apc_i - bpd_i;
+    const float t3_r = amc_r + bmd_i;
+    const float t3_i = amc_i - bmd_r;
+    yr[0] = apc_r + bpd_r;
+    yi[0] = apc_i + bpd_i;
+    yr[out_stride] = t1_r * w[0] - t1_i * w[m];
+    yi[out_stride] = t1_r * w[m] + t1_i * w[0];
+    yr[2 * out_stride] = t2_r * w[2 * m] - t2_i * w[3 * m];
+    yi[2 * out_stride] = t2_r * w[3 * m] + t2_i * w[2 * m];
+    yr[3 * out_stride] = t3_r * w[4 * m] - t3_i * w[5 * m];
+    yi[3 * out_stride] = t3_r * w[5 * m] + t3_i * w[4 * m];
+}
+
+#if defined(NS_FFT_NEON) || defined(NS_FFT_SSE4_1)
+#define NS_FFT_VECTOR 1
+
+#if defined(NS_FFT_NEON)
+
+typedef float32x4_t NsFftVector;
+
+static inline NsFftVector NsFftLoad(const float *in) { return vld1q_f32(in); }
+
+static inline void NsFftStore(float *out, NsFftVector v) { vst1q_f32(out, v); }
+
+static inline NsFftVector NsFftDup(float value) { return vdupq_n_f32(value); }
+
+static inline NsFftVector NsFftAdd(NsFftVector a, NsFftVector b) {
+    return vaddq_f32(a, b);
+}
+
+static inline NsFftVector NsFftSub(NsFftVector a, NsFftVector b) {
+    return vsubq_f32(a, b);
+}
+
+static inline NsFftVector NsFftMul(NsFftVector a, NsFftVector b) {
+    return vmulq_f32(a, b);
+}
+
+static inline NsFftVector NsFftNeg(NsFftVector a) { return vnegq_f32(a); }
+
+static inline NsFftVector NsFftReverse(NsFftVector a) {
+    a = vrev64q_f32(a);
+    return vextq_f32(a, a, 2);
+}
+
+// Four complex values from interleaved pairs.
+static inline void NsFftLoadComplex(const float *in,
+                                    NsFftVector *re,
+                                    NsFftVector *im) {
+    const float32x4x2_t v = vld2q_f32(in);
+    *re = v.val[0];
+    *im = v.val[1];
+}
+
+static inline void NsFftStoreComplex(float *out,
+                                     NsFftVector re,
+                                     NsFftVector im) {
+    float32x4x2_t v;
+    v.val[0] = re;
+    v.val[1] = im;
+    vst2q_f32(out, v);
+}
+
+// Stores lane j of vector k at out[4 * j + k].
+static inline void NsFftStoreTransposed(float *out,
+                                        NsFftVector v0,
+                                        NsFftVector v1,
+                                        NsFftVector v2,
+                                        NsFftVector v3) {
+    float32x4x4_t v;
+    v.val[0] = v0;
+    v.val[1] = v1;
+    v.val[2] = v2;
+    v.val[3] = v3;
+    vst4q_f32(out, v);
+}
+
+#else
+
+typedef __m128 NsFftVector;
+
+static inline NsFftVector NsFftLoad(const float *in) {
+    return _mm_loadu_ps(in);
+}
+
+static inline void NsFftStore(float *out, NsFftVector v) {
+    _mm_storeu_ps(out, v);
+}
+
+static inline NsFftVector NsFftDup(float value) { return _mm_set1_ps(value); }
+
+static inline NsFftVector NsFftAdd(NsFftVector a, NsFftVector b) {
+    return _mm_add_ps(a, b);
+}
+
+static inline NsFftVector NsFftSub(NsFftVector a, NsFftVector b) {
+    return _mm_sub_ps(a, b);
+}
+
+static inline NsFftVector NsFftMul(NsFftVector a, NsFftVector b) {
+    return _mm_mul_ps(a, b);
+}
+
+static inline NsFftVector NsFftNeg(NsFftVector a) {
+    return _mm_xor_ps(a, _mm_set1_ps(-0.f));
+}
+
+static inline NsFftVector NsFftReverse(NsFftVector a) {
+    return _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+static inline void NsFftLoadComplex(const float *in,
+                                    NsFftVector *re,
+                                    NsFftVector *im) {
+    const __m128 lo = _mm_loadu_ps(in);
+    const __m128 hi = _mm_loadu_ps(in + 4);
+    *re = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+    *im = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static inline void NsFftStoreComplex(float *out,
+                                     NsFftVector re,
+                                     NsFftVector im) {
+    _mm_storeu_ps(out, _mm_unpacklo_ps(re, im));
+    _mm_storeu_ps(out + 4, _mm_unpackhi_ps(re, im));
+}
+
+static inline void NsFftStoreTransposed(float *out,
+                                        NsFftVector v0,
+                                        NsFftVector v1,
+                                        NsFftVector v2,
+                                        NsFftVector v3) {
+    _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+    _mm_storeu_ps(out, v0);
+    _mm_storeu_ps(out + 4, v1);
+    _mm_storeu_ps(out + 8, v2);
+    _mm_storeu_ps(out + 12, v3);
+}
+
+#endif
+
+// NsFftButterfly on four lanes. x and y hold the real parts of a to d and of
+// the outputs, then their imaginary parts; w holds the real and imaginary
+// parts of w^p, w^2p and w^3p.
+static inline void NsFftButterflyVector(const NsFftVector *x,
+                                        const NsFftVector *w,
+                                        NsFftVector *y) {
+    const NsFftVector apc_r = NsFftAdd(x[0], x[2]);
+    const NsFftVector apc_i = NsFftAdd(x[4], x[6]);
+    const NsFftVector amc_r = NsFftSub(x[0], x[2]);
+    const NsFftVector amc_i = NsFftSub(x[4], x[6]);
+    const NsFftVector bpd_r = NsFftAdd(x[1], x[3]);
+    const NsFftVector bpd_i = NsFftAdd(x[5], x[7]);
+    const NsFftVector bmd_r = NsFftSub(x[1], x[3]);
+    const NsFftVector bmd_i = NsFftSub(x[5], x[7]);
+    const NsFftVector t1_r = NsFftSub(amc_r, bmd_i);
+    const NsFftVector t1_i = NsFftAdd(amc_i, bmd_r);
+    const NsFftVector t2_r = NsFftSub(apc_r, bpd_r);
+    const NsFftVector t2_i = NsFftSub(apc_i, bpd_i);
+    const NsFftVector t3_r = NsFftAdd(amc_r, bmd_i);
+    const NsFftVector t3_i = NsFftSub(amc_i, bmd_r);
+    y[0] = NsFftAdd(apc_r, bpd_r);
+    y[4] = NsFftAdd(apc_i, bpd_i);
+    y[1] = NsFftSub(NsFftMul(t1_r, w[0]), NsFftMul(t1_i, w[1]));
+    y[5] = NsFftAdd(NsFftMul(t1_r, w[1]), NsFftMul(t1_i, w[0]));
+    y[2] = NsFftSub(NsFftMul(t2_r, w[2]), NsFftMul(t2_i, w[3]));
+    y[6] = NsFftAdd(NsFftMul(t2_r, w[3]), NsFftMul(t2_i, w[2]));
+    y[3] = NsFftSub(NsFftMul(t3_r, w[4]), NsFftMul(t3_i, w[5]));
+    y[7] = NsFftAdd(NsFftMul(t3_r, w[5]), NsFftMul(t3_i, w[4]));
+}
+
+#endif  // NS_FFT_NEON || NS_FFT_SSE4_1
+
+// The radix-4 pass over n points of s interleaved transforms, from x to y.
+static void NsFftPass(size_t n,
+                      size_t s,
+                      const float *xr,
+                      const float *xi,
+                      float *yr,
+                      float *yi) {
+    const size_t m = n / 4;
+    const float *w = NS_FFT_PASS_TWIDDLES(n);
+    size_t p = 0;
+    size_t q;
+    if (s == 1) {
+        // The first pass: vectorized across butterflies, whose outputs are
+        // four apart.
+#if defined(NS_FFT_VECTOR)
+        for (; p + 4 <= m; p += 4) {
+            NsFftVector x[8], tw[6], y[8];
+            int k;
+            for (k = 0; k < 4; ++k) {
+                x[k] = NsFftLoad(xr + p + k * m);
+                x[4 + k] = NsFftLoad(xi + p + k * m);
+            }
+            for (k = 0; k < 6; ++k) {
+                tw[k] = NsFftLoad(w + p + k * m);
+            }
+            NsFftButterflyVector(x, tw, y);
+            NsFftStoreTransposed(yr + 4 * p, y[0], y[1], y[2], y[3]);
+            NsFftStoreTransposed(yi + 4 * p, y[4], y[5], y[6], y[7]);
+        }
+#endif
+        for (; p < m; ++p) {
+            NsFftButterfly(xr + p, xi + p, m, yr + 4 * p, yi + 4 * p, 1, w + p,
+                           m);
+        }
+        return;
+    }
+    // Later passes: vectorized across the interleaved transforms, which
+    // share their twiddles.
+    for (p = 0; p < m; ++p) {
+        const size_t in = s * p;
+        const size_t out = 4 * s * p;
+        q = 0;
+#if defined(NS_FFT_VECTOR)
+        NsFftVector tw[6];
+        int k;
+        for (k = 0; k < 6; ++k) {
+            tw[k] = NsFftDup(w[p + k * m]);
+        }
+        for (; q + 4 <= s; q += 4) {
+            NsFftVector x[8], y[8];
+            for (k = 0; k < 4; ++k) {
+                x[k] = NsFftLoad(xr + in + q + k * s * m);
+                x[4 + k] = NsFftLoad(xi + in + q + k * s * m);
+            }
+            NsFftButterflyVector(x, tw, y);
+            for (k = 0; k < 4; ++k) {
+                NsFftStore(yr + out + q + k * s, y[k]);
+                NsFftStore(yi + out + q + k * s, y[4 + k]);
+            }
+        }
+#endif
+        for (; q < s; ++q) {
+            NsFftButterfly(xr + in + q, xi + in + q, s * m, yr + out + q,
+                           yi + out + q, s, w + p, m);
+        }
+    }
+}
+
+// The closing radix-2 pass of s interleaved transforms of two points.
+static void NsFftPass2(size_t s,
+                       const float *xr,
+                       const float *xi,
+                       float *yr,
+                       float *yi) {
+    size_t q = 0;
+#if defined(NS_FFT_VECTOR)
+    for (; q + 4 <= s; q += 4) {
+        const NsFftVector ar = NsFftLoad(xr + q);
+        const NsFftVector ai = NsFftLoad(xi + q);
+        const NsFftVector br = NsFftLoad(xr + s + q);
+        const NsFftVector bi = NsFftLoad(xi + s + q);
+        NsFftStore(yr + q, NsFftAdd(ar, br));
+        NsFftStore(yi + q, NsFftAdd(ai, bi));
+        NsFftStore(yr + s + q, NsFftSub(ar, br));
+        NsFftStore(yi + s + q, NsFftSub(ai, bi));
+    }
+#endif
+    for (; q < s; ++q) {
+        const float ar = xr[q];
+        const float ai = xi[q];
+        const float br = xr[s + q];
+        const float bi = xi[s + q];
+        yr[q] = ar + br;
+        yi[q] = ai + bi;
+        yr[s + q] = ar - br;
+        yi[s + q] = ai - bi;
+    }
+}
+
+// Transforms the size complex values in z[0] and z[1] with
+// Z[k] = sum_j z[j] exp(2 pi i j k / size), using z[2] and z[3] as scratch.
+// Returns the index of the real parts in z, the imaginary ones following.
+static int NsFftComplex(size_t size, float z[4][kNsFftMaxComplexSize]) {
+    int x = 0;
+    size_t n;
+    size_t s = 1;
+    for (n = size; n >= 4; n /= 4) {
+        NsFftPass(n, s, z[x], z[x + 1], z[2 - x], z[3 - x]);
+        x = 2 - x;
+        s *= 4;
+    }
+    if (n == 2) {
+        NsFftPass2(s, z[x], z[x + 1], z[2 - x], z[3 - x]);
+        x = 2 - x;
+    }
+    return x;
+}
+
+static void NsRdft(float *a, size_t length) {
+    float z[4][kNsFftMaxComplexSize];
+    const size_t size = length / 2;
+    const size_t half = length / 4;
+    const float *c =
+            length == 256 ? kNsFftSplitTwiddles256 : kNsFftSplitTwiddles128;
+    const float *s = c + half;
+    size_t k = 0;
+#if defined(NS_FFT_VECTOR)
+    for (; k + 4 <= size; k += 4) {
+        NsFftVector re, im;
+        NsFftLoadComplex(a + 2 * k, &re, &im);
+        NsFftStore(z[0] + k, re);
+        NsFftStore(z[1] + k, im);
+    }
+#endif
+    for (; k < size; ++k) {
+        z[0][k] = a[2 * k];
+        z[1][k] = a[2 * k + 1];
+    }
+    const int x = NsFftComplex(size, z);
+    const float *zr = z[x];
+    const float *zi = z[x + 1];
+
+    // With E and O the transforms of the even and odd samples, Z[k] is
+    // E[k] + i O[k] and X[k] = E[k] + w^k O[k]; bins k and size - k come
+    // from the same pair of Z.
+    a[0] = zr[0] + zi[0];
+    a[1] = zr[0] - zi[0];
+    k = 1;
+#if defined(NS_FFT_VECTOR)
+    const NsFftVector one_half = NsFftDup(0.5f);
+    for (; k + 4 <= half; k += 4) {
+        const NsFftVector zkr = NsFftLoad(zr + k);
+        const NsFftVector zki = NsFftLoad(zi + k);
+        const NsFftVector zmr = NsFftReverse(NsFftLoad(zr + size - k - 3));
+        const NsFftVector zmi = NsFftReverse(NsFftLoad(zi + size - k - 3));
+        const NsFftVector er = NsFftMul(one_half, NsFftAdd(zkr, zmr));
+        const NsFftVector ei = NsFftMul(one_half, NsFftSub(zki, zmi));
+        const NsFftVector or_ = NsFftMul(one_half, NsFftAdd(zki, zmi));
+        const NsFftVector oi = NsFftMul(one_half, NsFftSub(zmr, zkr));
+        const NsFftVector wr = NsFftLoad(c + k);
+        const NsFftVector wi = NsFftLoad(s + k);
+        const NsFftVector tr = NsFftSub(NsFftMul(or_, wr), NsFftMul(oi, wi));
+        const NsFftVector ti = NsFftAdd(NsFftMul(or_, wi), NsFftMul(oi, wr));
+        NsFftStoreComplex(a + 2 * k, NsFftAdd(er, tr), NsFftAdd(ei, ti));
+        NsFftStoreComplex(a + 2 * (size - k - 3),
+                          NsFftReverse(NsFftSub(er, tr)),
+                          NsFftReverse(NsFftSub(ti, ei)));
+    }
+#endif
+    for (; k < half; ++k) {
+        const float er = 0.5f * (zr[k] + zr[size - k]);
+        const float ei = 0.5f * (zi[k] - zi[size - k]);
+        const float or_ = 0.5f * (zi[k] + zi[size - k]);
+        const float oi = 0.5f * (zr[size - k] - zr[k]);
+        const float tr = or_ * c[k] - oi * s[k];
+        const float ti = or_ * s[k] + oi * c[k];
+        a[2 * k] = er + tr;
+        a[2 * k + 1] = ei + ti;
+        a[2 * (size - k)] = er - tr;
+        a[2 * (size - k) + 1] = ti - ei;
+    }
+    a[size] = zr[half];
+    a[size + 1] = zi[half];
+}
+
+static void NsInverseRdft(float *a, size_t length) {
+    float z[4][kNsFftMaxComplexSize];
+    const size_t size = length / 2;
+    const size_t half = length / 4;
+    const float *c =
+            length == 256 ? kNsFftSplitTwiddles256 : kNsFftSplitTwiddles128;
+    const float *s = c + half;
+
+    // Rebuilds Z = E + i O from bins k and size - k, conjugated so that the
+    // forward complex transform computes the inverse one.
+    float *zr = z[0];
+    float *zi = z[1];
+    zr[0] = 0.5f * (a[0] + a[1]);
+    zi[0] = -(0.5f * (a[0] - a[1]));
+    size_t k = 1;
+#if defined(NS_FFT_VECTOR)
+    const NsFftVector one_half = NsFftDup(0.5f);
+    for (; k + 4 <= half; k += 4) {
+        NsFftVector akr, aki, amr, ami;
+        NsFftLoadComplex(a + 2 * k, &akr, &aki);
+        NsFftLoadComplex(a + 2 * (size - k - 3), &amr, &ami);
+        amr = NsFftReverse(amr);
+        ami = NsFftReverse(ami);
+        const NsFftVector er = NsFftMul(one_half, NsFftAdd(akr, amr));
+        const NsFftVector ei = NsFftMul(one_half, NsFftSub(aki, ami));
+        const NsFftVector dr = NsFftMul(one_half, NsFftSub(akr, amr));
+        const NsFftVector di = NsFftMul(one_half, NsFftAdd(aki, ami));
+        const NsFftVector wr = NsFftLoad(c + k);
+        const NsFftVector wi = NsFftLoad(s + k);
+        const NsFftVector or_ = NsFftAdd(NsFftMul(dr, wr), NsFftMul(di, wi));
+        const NsFftVector oi = NsFftSub(NsFftMul(di, wr), NsFftMul(dr, wi));
+        NsFftStore(zr + k, NsFftSub(er, oi));
+        NsFftStore(zi + k, NsFftNeg(NsFftAdd(ei, or_)));
+        NsFftStore(zr + size - k - 3, NsFftReverse(NsFftAdd(er, oi)));
+        NsFftStore(zi + size - k - 3, NsFftReverse(NsFftSub(ei, or_)));
+    }
+#endif
+    for (; k < half; ++k) {
+        const float er = 0.5f * (a[2 * k] + a[2 * (size - k)]);
+        const float ei = 0.5f * (a[2 * k + 1] - a[2 * (size - k) + 1]);
+        const float dr = 0.5f * (a[2 * k] - a[2 * (size - k)]);
+        const float di = 0.5f * (a[2 * k + 1] + a[2 * (size - k) + 1]);
+        const float or_ = dr * c[k] + di * s[k];
+        const float oi = di * c[k] - dr * s[k];
+        zr[k] = er - oi;
+        zi[k] = -(ei + or_);
+        zr[size - k] = er + oi;
+        zi[size - k] = ei - or_;
+    }
+    zr[half] = a[size];
+    zi[half] = -a[size + 1];
+
+    const int x = NsFftComplex(size, z);
+    zr = z[x];
+    zi = z[x + 1];
+    k = 0;
+#if defined(NS_FFT_VECTOR)
+    for (; k + 4 <= size; k += 4) {
+        NsFftStoreComplex(a + 2 * k, NsFftLoad(zr + k),
+                          NsFftNeg(NsFftLoad(zi + k)));
+    }
+#endif
+    for (; k < size; ++k) {
+        a[2 * k] = zr[k];
+        a[2 * k + 1] = -zi[k];
+    }
+}
+
+#endif  // WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_FFT_KERNELS_H_
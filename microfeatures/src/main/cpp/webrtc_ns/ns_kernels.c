@@ -0,0 +1,35 @@
+#include "ns_kernels.h"
+
+// Slowest first.
+static const NsKernels *const kNsKernelsVariants[] = {
+        &kNsKernelsScalar,
+#if defined(NS_KERNELS_HAVE_NEON)
+        &kNsKernelsNeon,
+#endif
+#if defined(NS_KERNELS_HAVE_SSE4_1)
+        &kNsKernelsSse4_1,
+#endif
+};
+
+int NsKernelsCount(void) {
+    return sizeof(kNsKernelsVariants) / sizeof(kNsKernelsVariants[0]);
+}
+
+const NsKernels *NsKernelsVariant(int index) {
+    return kNsKernelsVariants[index];
+}
+
+const NsKernels *NsKernelsForFeatures(int features) {
+    int i;
+    for (i = NsKernelsCount() - 1; i > 0; --i) {
+        const NsKernels *kernels = kNsKernelsVariants[i];
+        if ((kernels->required_features & ~features) == 0) {
+            return kernels;
+        }
+    }
+    return &kNsKernelsScalar;
+}
+
+const NsKernels *NsKernelsSelect(void) {
+    return NsKernelsForFeatures(CpuFeaturesDetect());
+}
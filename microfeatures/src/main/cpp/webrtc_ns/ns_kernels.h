@@ -0,0 +1,106 @@
+/*
+ * Spectral loops of the noise suppressor, built once per instruction set and
+ * chosen from the CPU features when an instance is created. Every variant
+ * gives bit-identical results: the kernels are compiled without contracting
+ * multiplies and adds, and sums whose order matters stay in
+ * noise_suppression.c.
+ */
+#ifndef WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_KERNELS_H_
+#define WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_KERNELS_H_
+
+#include <stddef.h>
+
+#include "tensorflow/lite/experimental/microfrontend/lib/cpu_features.h"
+
+// The vector variants built for the target architecture. NEON is only used
+// on 64-bit ARM, where it has exact division and square root.
+#if defined(__aarch64__)
+#define NS_KERNELS_HAVE_NEON 1
+#elif defined(__x86_64__) || defined(__i386__)
+#define NS_KERNELS_HAVE_SSE4_1 1
+#endif
+
+// Relative error bounds of approx_log1p and approx_exp, measured against
+// double precision over every float in their ranges; see ns_math_kernels.h.
+#define kNsLog1pErrorBound 1.3e-7f
+#define kNsExpErrorBound 8.5e-8f
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct NsKernels_ {
+    // "scalar", "neon" or "sse4.1".
+    const char *name;
+    // kCpuFeature bits the CPU must have to run these kernels.
+    int required_features;
+
+    // out[i] = a[i] * b[i].
+    void (*multiply)(const float *a, const float *b, float *out, size_t length);
+    // Splits the interleaved bins 1..length of an rdft output into |real| and
+    // |imag|, with |energy| = real^2 + imag^2 and |magn| = sqrt(energy + eps).
+    void (*magnitude)(const float *spectrum,
+                      float *real,
+                      float *imag,
+                      float *energy,
+                      float *magn,
+                      size_t length);
+    // The decision-directed Wiener filter of ComputeDdBasedWienerFilter.
+    void (*wiener_filter)(const float *magn,
+                          const float *magn_prev,
+                          const float *smooth,
+                          const float *noise,
+                          const float *noise_prev,
+                          float overdrive,
+                          float *filter,
+                          size_t length);
+    // Clamps |filter| to [denoise_bound, 1], stores it in |smooth| and applies
+    // it to |real| and |imag|.
+    void (*apply_filter)(float *filter,
+                         float *smooth,
+                         float *real,
+                         float *imag,
+                         float denoise_bound,
+                         size_t length);
+    // synthesis[i] += factor * data[i] * window[i].
+    void (*synthesize)(float *synthesis,
+                       const float *data,
+                       const float *window,
+                       float factor,
+                       size_t length);
+    // The real FFT of |length| points, 128 or 256, in place, packed as by
+    // Ooura's rdft; see ns_fft_kernels.h.
+    void (*rdft)(float *data, size_t length);
+    // The inverse of rdft scaled by length / 2, as rdft with isgn -1.
+    void (*inverse_rdft)(float *data, size_t length);
+    // out[i] = log(1 + in[i]) for in[i] >= 0, by polynomial.
+    void (*approx_log1p)(const float *in, float *out, size_t length);
+    // out[i] = exp(scale * in[i]), by polynomial.
+    void (*approx_exp)(const float *in, float scale, float *out, size_t length);
+} NsKernels;
+
+extern const NsKernels kNsKernelsScalar;
+#if defined(NS_KERNELS_HAVE_NEON)
+extern const NsKernels kNsKernelsNeon;
+#endif
+#if defined(NS_KERNELS_HAVE_SSE4_1)
+extern const NsKernels kNsKernelsSse4_1;
+#endif
+
+// Number of variants built into the library.
+int NsKernelsCount(void);
+
+// The variants by index, the scalar one first.
+const NsKernels *NsKernelsVariant(int index);
+
+// The fastest variant that only needs the given kCpuFeature bits.
+const NsKernels *NsKernelsForFeatures(int features);
+
+// The fastest variant the running CPU supports.
+const NsKernels *NsKernelsSelect(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_KERNELS_H_
@@ -0,0 +1,9 @@
+// The NEON kernels, for 64-bit ARM only.
+#include "ns_kernels.h"
+
+#if defined(NS_KERNELS_HAVE_NEON)
+#define NS_KERNELS_TABLE kNsKernelsNeon
+#define NS_KERNELS_NAME "neon"
+#define NS_KERNELS_FEATURES kCpuFeatureNeon
+#include "ns_kernels_variant.h"
+#endif
@@ -0,0 +1,7 @@
+// The portable kernels, without vector intrinsics even where the compiler
+// targets an instruction set that has them.
+#define NS_KERNELS_SCALAR 1
+#define NS_KERNELS_TABLE kNsKernelsScalar
+#define NS_KERNELS_NAME "scalar"
+#define NS_KERNELS_FEATURES 0
+#include "ns_kernels_variant.h"
@@ -0,0 +1,241 @@
+/*
+ * Defines NS_KERNELS_TABLE, named NS_KERNELS_NAME and requiring
+ * NS_KERNELS_FEATURES, for the instruction set of the including file. Only
+ * the ns_kernels_*.c files include this, and they are built with
+ * -ffp-contract=off so the vector and scalar loops round the same way.
+ */
+#ifndef WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_KERNELS_VARIANT_H_
+#define WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_KERNELS_VARIANT_H_
+
+#include <math.h>
+
+#include "ns_kernels.h"
+#include "ns_fft_kernels.h"
+#include "ns_math_kernels.h"
+#include "noise_suppression.h"
+
+#if defined(NS_KERNELS_SCALAR)
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define NS_KERNELS_NEON 1
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define NS_KERNELS_SSE4_1 1
+#endif
+
+// Same values as epsilon and epsilon_squ in noise_suppression.c.
+#define NS_KERNELS_EPSILON 1e-7f
+#define NS_KERNELS_EPSILON_SQU 1e-12f
+
+static void NsMultiply(const float *a, const float *b, float *out,
+                       size_t length) {
+    size_t i = 0;
+#if defined(NS_KERNELS_NEON)
+    for (; i + 4 <= length; i += 4) {
+        vst1q_f32(out + i, vmulq_f32(vld1q_f32(a + i), vld1q_f32(b + i)));
+    }
+#elif defined(NS_KERNELS_SSE4_1)
+    for (; i + 4 <= length; i += 4) {
+        _mm_storeu_ps(out + i,
+                      _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+#endif
+    for (; i < length; ++i) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+static void NsMagnitude(const float *spectrum,
+                        float *real,
+                        float *imag,
+                        float *energy,
+                        float *magn,
+                        size_t length) {
+    size_t i = 0;
+    // Bin i is at spectrum[2 * i], bin 0 being packed with the last one.
+#if defined(NS_KERNELS_NEON)
+    const float32x4_t eps = vdupq_n_f32(NS_KERNELS_EPSILON_SQU);
+    for (; i + 4 <= length; i += 4) {
+        const float32x4x2_t bins = vld2q_f32(spectrum + 2 * (i + 1));
+        const float32x4_t e = vaddq_f32(vmulq_f32(bins.val[0], bins.val[0]),
+                                        vmulq_f32(bins.val[1], bins.val[1]));
+        vst1q_f32(real + 1 + i, bins.val[0]);
+        vst1q_f32(imag + 1 + i, bins.val[1]);
+        vst1q_f32(energy + 1 + i, e);
+        vst1q_f32(magn + 1 + i, vsqrtq_f32(vaddq_f32(e, eps)));
+    }
+#elif defined(NS_KERNELS_SSE4_1)
+    const __m128 eps = _mm_set1_ps(NS_KERNELS_EPSILON_SQU);
+    for (; i + 4 <= length; i += 4) {
+        const __m128 lo = _mm_loadu_ps(spectrum + 2 * (i + 1));
+        const __m128 hi = _mm_loadu_ps(spectrum + 2 * (i + 1) + 4);
+        const __m128 re = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 im = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128 e = _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im));
+        _mm_storeu_ps(real + 1 + i, re);
+        _mm_storeu_ps(imag + 1 + i, im);
+        _mm_storeu_ps(energy + 1 + i, e);
+        _mm_storeu_ps(magn + 1 + i, _mm_sqrt_ps(_mm_add_ps(e, eps)));
+    }
+#endif
+    for (; i < length; ++i) {
+        const float re = spectrum[2 * (i + 1)];
+        const float im = spectrum[2 * (i + 1) + 1];
+        const float e = re * re + im * im;
+        real[1 + i] = re;
+        imag[1 + i] = im;
+        energy[1 + i] = e;
+        magn[1 + i] = sqrtf(e + NS_KERNELS_EPSILON_SQU);
+    }
+}
+
+static void NsWienerFilter(const float *magn,
+                           const float *magn_prev,
+                           const float *smooth,
+                           const float *noise,
+                           const float *noise_prev,
+                           float overdrive,
+                           float *filter,
+                           size_t length) {
+    size_t i = 0;
+#if defined(NS_KERNELS_NEON)
+    const float32x4_t eps = vdupq_n_f32(NS_KERNELS_EPSILON);
+    const float32x4_t dd = vdupq_n_f32(DD_PR_SNR);
+    const float32x4_t one_minus_dd = vdupq_n_f32(1.f - DD_PR_SNR);
+    const float32x4_t over = vdupq_n_f32(overdrive);
+    for (; i + 4 <= length; i += 4) {
+        const float32x4_t m = vld1q_f32(magn + i);
+        const float32x4_t n = vld1q_f32(noise + i);
+        const float32x4_t previous =
+                vdivq_f32(vmulq_f32(vld1q_f32(magn_prev + i),
+                                    vld1q_f32(smooth + i)),
+                          vaddq_f32(vld1q_f32(noise_prev + i), eps));
+        const float32x4_t current = vreinterpretq_f32_u32(vandq_u32(
+                vcgtq_f32(m, n),
+                vreinterpretq_u32_f32(
+                        vdivq_f32(vsubq_f32(m, n), vaddq_f32(n, eps)))));
+        const float32x4_t snr = vaddq_f32(vmulq_f32(dd, previous),
+                                          vmulq_f32(one_minus_dd, current));
+        vst1q_f32(filter + i, vdivq_f32(snr, vaddq_f32(over, snr)));
+    }
+#elif defined(NS_KERNELS_SSE4_1)
+    const __m128 eps = _mm_set1_ps(NS_KERNELS_EPSILON);
+    const __m128 dd = _mm_set1_ps(DD_PR_SNR);
+    const __m128 one_minus_dd = _mm_set1_ps(1.f - DD_PR_SNR);
+    const __m128 over = _mm_set1_ps(overdrive);
+    for (; i + 4 <= length; i += 4) {
+        const __m128 m = _mm_loadu_ps(magn + i);
+        const __m128 n = _mm_loadu_ps(noise + i);
+        const __m128 previous =
+                _mm_div_ps(_mm_mul_ps(_mm_loadu_ps(magn_prev + i),
+                                      _mm_loadu_ps(smooth + i)),
+                           _mm_add_ps(_mm_loadu_ps(noise_prev + i), eps));
+        const __m128 current =
+                _mm_and_ps(_mm_cmpgt_ps(m, n),
+                           _mm_div_ps(_mm_sub_ps(m, n), _mm_add_ps(n, eps)));
+        const __m128 snr = _mm_add_ps(_mm_mul_ps(dd, previous),
+                                      _mm_mul_ps(one_minus_dd, current));
+        _mm_storeu_ps(filter + i, _mm_div_ps(snr, _mm_add_ps(over, snr)));
+    }
+#endif
+    for (; i < length; ++i) {
+        const float previous =
+                magn_prev[i] * smooth[i] / (noise_prev[i] + NS_KERNELS_EPSILON);
+        float current = 0.f;
+        if (magn[i] > noise[i]) {
+            current = (magn[i] - noise[i]) / (noise[i] + NS_KERNELS_EPSILON);
+        }
+        const float snr = DD_PR_SNR * previous + (1.f - DD_PR_SNR) * current;
+        filter[i] = snr / (overdrive + snr);
+    }
+}
+
+static void NsApplyFilter(float *filter,
+                          float *smooth,
+                          float *real,
+                          float *imag,
+                          float denoise_bound,
+                          size_t length) {
+    size_t i = 0;
+#if defined(NS_KERNELS_NEON)
+    const float32x4_t bound = vdupq_n_f32(denoise_bound);
+    const float32x4_t one = vdupq_n_f32(1.f);
+    for (; i + 4 <= length; i += 4) {
+        float32x4_t f = vld1q_f32(filter + i);
+        f = vbslq_f32(vcltq_f32(f, bound), bound, f);
+        f = vbslq_f32(vcgtq_f32(f, one), one, f);
+        vst1q_f32(filter + i, f);
+        vst1q_f32(smooth + i, f);
+        vst1q_f32(real + i, vmulq_f32(vld1q_f32(real + i), f));
+        vst1q_f32(imag + i, vmulq_f32(vld1q_f32(imag + i), f));
+    }
+#elif defined(NS_KERNELS_SSE4_1)
+    const __m128 bound = _mm_set1_ps(denoise_bound);
+    const __m128 one = _mm_set1_ps(1.f);
+    for (; i + 4 <= length; i += 4) {
+        __m128 f = _mm_loadu_ps(filter + i);
+        f = _mm_blendv_ps(f, bound, _mm_cmplt_ps(f, bound));
+        f = _mm_blendv_ps(f, one, _mm_cmpgt_ps(f, one));
+        _mm_storeu_ps(filter + i, f);
+        _mm_storeu_ps(smooth + i, f);
+        _mm_storeu_ps(real + i, _mm_mul_ps(_mm_loadu_ps(real + i), f));
+        _mm_storeu_ps(imag + i, _mm_mul_ps(_mm_loadu_ps(imag + i), f));
+    }
+#endif
+    for (; i < length; ++i) {
+        float f = filter[i];
+        if (f < denoise_bound) {
+            f = denoise_bound;
+        }
+        if (f > 1.f) {
+            f = 1.f;
+        }
+        filter[i] = f;
+        smooth[i] = f;
+        real[i] *= f;
+        imag[i] *= f;
+    }
+}
+
+static void NsSynthesize(float *synthesis,
+                         const float *data,
+                         const float *window,
+                         float factor,
+                         size_t length) {
+    size_t i = 0;
+#if defined(NS_KERNELS_NEON)
+    const float32x4_t f = vdupq_n_f32(factor);
+    for (; i + 4 <= length; i += 4) {
+        const float32x4_t v = vmulq_f32(vmulq_f32(f, vld1q_f32(data + i)),
+                                        vld1q_f32(window + i));
+        vst1q_f32(synthesis + i, vaddq_f32(vld1q_f32(synthesis + i), v));
+    }
+#elif defined(NS_KERNELS_SSE4_1)
+    const __m128 f = _mm_set1_ps(factor);
+    for (; i + 4 <= length; i += 4) {
+        const __m128 v = _mm_mul_ps(_mm_mul_ps(f, _mm_loadu_ps(data + i)),
+                                    _mm_loadu_ps(window + i));
+        _mm_storeu_ps(synthesis + i,
+                      _mm_add_ps(_mm_loadu_ps(synthesis + i), v));
+    }
+#endif
+    for (; i < length; ++i) {
+        synthesis[i] += factor * data[i] * window[i];
+    }
+}
+
+const NsKernels NS_KERNELS_TABLE = {
+        NS_KERNELS_NAME,
+        NS_KERNELS_FEATURES,
+        NsMultiply,
+        NsMagnitude,
+        NsWienerFilter,
+        NsApplyFilter,
+        NsSynthesize,
+        NsRdft,
+        NsInverseRdft,
+        NsLog1p,
+        NsExp,
+};
+
+#endif  // WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_KERNELS_VARIANT_H_
@@ -0,0 +1,260 @@
+/*
+ * Polynomial log1p and exp for the per-bin loops of the noise suppressor,
+ * after the single precision logf and expf of the Cephes library. Checked
+ * against double precision on every float input, the relative error is
+ * below kNsLog1pErrorBound for NsLog1p on [0, 1e10] and below
+ * kNsExpErrorBound for NsExp on [-87.3, 88]. Past +-88.37 NsExp saturates
+ * at 2.4e38 and 0 rather than overflowing; NsLog1p is only meant for the
+ * magnitudes and SNRs of the suppressor, which are finite and not negative.
+ *
+ * Included by ns_kernels_variant.h. The vector loops run the same operations
+ * as the scalar tails, so every variant gives identical bits.
+ */
+#ifndef WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_MATH_KERNELS_H_
+#define WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_MATH_KERNELS_H_
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(NS_KERNELS_SCALAR)
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define NS_MATH_NEON 1
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define NS_MATH_SSE4_1 1
+#endif
+
+#define kNsMathSqrt2 1.41421356f
+// ln(2) split so that n * kNsMathLn2High is exact for the exponents used.
+#define kNsMathLn2High 0.693359375f
+#define kNsMathLn2Low -2.12194440e-4f
+#define kNsMathLog2e 1.44269504088896341f
+#define kNsMathExpLimit 88.3762626647949f
+
+// Cephes logf: log(1 + f) = f - f^2 / 2 + f^3 P(f) for f in
+// [sqrt(1/2) - 1, sqrt(2) - 1].
+#define kNsMathLogP0 7.0376836292e-2f
+#define kNsMathLogP1 -1.1514610310e-1f
+#define kNsMathLogP2 1.1676998740e-1f
+#define kNsMathLogP3 -1.2420140846e-1f
+#define kNsMathLogP4 1.4249322787e-1f
+#define kNsMathLogP5 -1.6668057665e-1f
+#define kNsMathLogP6 2.0000714765e-1f
+#define kNsMathLogP7 -2.4999993993e-1f
+#define kNsMathLogP8 3.3333331174e-1f
+
+// Cephes expf: exp(r) = 1 + r + r^2 P(r) for |r| <= ln(2) / 2.
+#define kNsMathExpP0 1.9875691500e-4f
+#define kNsMathExpP1 1.3981999507e-3f
+#define kNsMathExpP2 8.3334519073e-3f
+#define kNsMathExpP3 4.1665795894e-2f
+#define kNsMathExpP4 1.6666665459e-1f
+#define kNsMathExpP5 5.0000001201e-1f
+
+static inline uint32_t NsMathBits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline float NsMathFloat(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// log(1 + x) as log(u) for u = 1 + x, plus (x - (u - 1)) / u for the part of
+// x lost in rounding u, which keeps the error relative for small x.
+static inline float NsLog1pScalar(float x) {
+    const float u = 1.f + x;
+    const uint32_t bits = NsMathBits(u);
+    float e = (float) ((int32_t) (bits >> 23) - 127);
+    float m = NsMathFloat((bits & 0x7fffff) | 0x3f800000);
+    const int high = m > kNsMathSqrt2;
+    m = high ? 0.5f * m : m;
+    e = high ? e + 1.f : e;
+    const float f = m - 1.f;
+    const float z = f * f;
+    float y = kNsMathLogP0;
+    y = y * f + kNsMathLogP1;
+    y = y * f + kNsMathLogP2;
+    y = y * f + kNsMathLogP3;
+    y = y * f + kNsMathLogP4;
+    y = y * f + kNsMathLogP5;
+    y = y * f + kNsMathLogP6;
+    y = y * f + kNsMathLogP7;
+    y = y * f + kNsMathLogP8;
+    y = y * f * z;
+    y = y + e * kNsMathLn2Low;
+    y = y + -0.5f * z;
+    float log_u = f + y;
+    log_u = log_u + e * kNsMathLn2High;
+    return log_u + (x - (u - 1.f)) / u;
+}
+
+// exp(x) as 2^n exp(r) with n = round(x / ln(2)).
+static inline float NsExpScalar(float x) {
+    x = x > kNsMathExpLimit ? kNsMathExpLimit : x;
+    x = x < -kNsMathExpLimit ? -kNsMathExpLimit : x;
+    const float n = floorf(x * kNsMathLog2e + 0.5f);
+    x = x - n * kNsMathLn2High;
+    x = x - n * kNsMathLn2Low;
+    const float z = x * x;
+    float y = kNsMathExpP0;
+    y = y * x + kNsMathExpP1;
+    y = y * x + kNsMathExpP2;
+    y = y * x + kNsMathExpP3;
+    y = y * x + kNsMathExpP4;
+    y = y * x + kNsMathExpP5;
+    y = y * z + x + 1.f;
+    return y * NsMathFloat((uint32_t) ((int32_t) n + 127) << 23);
+}
+
+#if defined(NS_MATH_NEON)
+
+static inline float32x4_t NsLog1pVector(float32x4_t x) {
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t u = vaddq_f32(one, x);
+    const uint32x4_t bits = vreinterpretq_u32_f32(u);
+    float32x4_t e = vcvtq_f32_s32(vsubq_s32(
+            vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+    float32x4_t m = vreinterpretq_f32_u32(vorrq_u32(
+            vandq_u32(bits, vdupq_n_u32(0x7fffff)), vdupq_n_u32(0x3f800000)));
+    const uint32x4_t high = vcgtq_f32(m, vdupq_n_f32(kNsMathSqrt2));
+    m = vbslq_f32(high, vmulq_f32(vdupq_n_f32(0.5f), m), m);
+    e = vbslq_f32(high, vaddq_f32(e, one), e);
+    const float32x4_t f = vsubq_f32(m, one);
+    const float32x4_t z = vmulq_f32(f, f);
+    float32x4_t y = vdupq_n_f32(kNsMathLogP0);
+    y = vaddq_f32(vmulq_f32(y, f), vdupq_n_f32(kNsMathLogP1));
+    y = vaddq_f32(vmulq_f32(y, f), vdupq_n_f32(kNsMathLogP2));
+    y = vaddq_f32(vmulq_f32(y, f), vdupq_n_f32(kNsMathLogP3));
+    y = vaddq_f32(vmulq_f32(y, f), vdupq_n_f32(kNsMathLogP4));
+    y = vaddq_f32(vmulq_f32(y, f), vdupq_n_f32(kNsMathLogP5));
+    y = vaddq_f32(vmulq_f32(y, f), vdupq_n_f32(kNsMathLogP6));
+    y = vaddq_f32(vmulq_f32(y, f), vdupq_n_f32(kNsMathLogP7));
+    y = vaddq_f32(vmulq_f32(y, f), vdupq_n_f32(kNsMathLogP8));
+    y = vmulq_f32(vmulq_f32(y, f), z);
+    y = vaddq_f32(y, vmulq_f32(e, vdupq_n_f32(kNsMathLn2Low)));
+    y = vaddq_f32(y, vmulq_f32(vdupq_n_f32(-0.5f), z));
+    float32x4_t log_u = vaddq_f32(f, y);
+    log_u = vaddq_f32(log_u, vmulq_f32(e, vdupq_n_f32(kNsMathLn2High)));
+    return vaddq_f32(log_u,
+                     vdivq_f32(vsubq_f32(x, vsubq_f32(u, one)), u));
+}
+
+static inline float32x4_t NsExpVector(float32x4_t x) {
+    x = vminq_f32(x, vdupq_n_f32(kNsMathExpLimit));
+    x = vmaxq_f32(x, vdupq_n_f32(-kNsMathExpLimit));
+    const float32x4_t n = vrndmq_f32(vaddq_f32(
+            vmulq_f32(x, vdupq_n_f32(kNsMathLog2e)), vdupq_n_f32(0.5f)));
+    x = vsubq_f32(x, vmulq_f32(n, vdupq_n_f32(kNsMathLn2High)));
+    x = vsubq_f32(x, vmulq_f32(n, vdupq_n_f32(kNsMathLn2Low)));
+    const float32x4_t z = vmulq_f32(x, x);
+    float32x4_t y = vdupq_n_f32(kNsMathExpP0);
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(kNsMathExpP1));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(kNsMathExpP2));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(kNsMathExpP3));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(kNsMathExpP4));
+    y = vaddq_f32(vmulq_f32(y, x), vdupq_n_f32(kNsMathExpP5));
+    y = vaddq_f32(vaddq_f32(vmulq_f32(y, z), x), vdupq_n_f32(1.f));
+    const int32x4_t scale =
+            vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127)), 23);
+    return vmulq_f32(y, vreinterpretq_f32_s32(scale));
+}
+
+#elif defined(NS_MATH_SSE4_1)
+
+static inline __m128 NsLog1pVector(__m128 x) {
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 u = _mm_add_ps(one, x);
+    const __m128i bits = _mm_castps_si128(u);
+    __m128 e = _mm_cvtepi32_ps(
+            _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+    __m128 m = _mm_castsi128_ps(
+            _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x7fffff)),
+                         _mm_set1_epi32(0x3f800000)));
+    const __m128 high = _mm_cmpgt_ps(m, _mm_set1_ps(kNsMathSqrt2));
+    m = _mm_blendv_ps(m, _mm_mul_ps(_mm_set1_ps(0.5f), m), high);
+    e = _mm_blendv_ps(e, _mm_add_ps(e, one), high);
+    const __m128 f = _mm_sub_ps(m, one);
+    const __m128 z = _mm_mul_ps(f, f);
+    __m128 y = _mm_set1_ps(kNsMathLogP0);
+    y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(kNsMathLogP1));
+    y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(kNsMathLogP2));
+    y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(kNsMathLogP3));
+    y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(kNsMathLogP4));
+    y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(kNsMathLogP5));
+    y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(kNsMathLogP6));
+    y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(kNsMathLogP7));
+    y = _mm_add_ps(_mm_mul_ps(y, f), _mm_set1_ps(kNsMathLogP8));
+    y = _mm_mul_ps(_mm_mul_ps(y, f), z);
+    y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(kNsMathLn2Low)));
+    y = _mm_add_ps(y, _mm_mul_ps(_mm_set1_ps(-0.5f), z));
+    __m128 log_u = _mm_add_ps(f, y);
+    log_u = _mm_add_ps(log_u, _mm_mul_ps(e, _mm_set1_ps(kNsMathLn2High)));
+    return _mm_add_ps(log_u,
+                      _mm_div_ps(_mm_sub_ps(x, _mm_sub_ps(u, one)), u));
+}
+
+static inline __m128 NsExpVector(__m128 x) {
+    x = _mm_min_ps(x, _mm_set1_ps(kNsMathExpLimit));
+    x = _mm_max_ps(x, _mm_set1_ps(-kNsMathExpLimit));
+    const __m128 n = _mm_floor_ps(_mm_add_ps(
+            _mm_mul_ps(x, _mm_set1_ps(kNsMathLog2e)), _mm_set1_ps(0.5f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(kNsMathLn2High)));
+    x = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(kNsMathLn2Low)));
+    const __m128 z = _mm_mul_ps(x, x);
+    __m128 y = _mm_set1_ps(kNsMathExpP0);
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(kNsMathExpP1));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(kNsMathExpP2));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(kNsMathExpP3));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(kNsMathExpP4));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(kNsMathExpP5));
+    y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(y, z), x), _mm_set1_ps(1.f));
+    const __m128i scale = _mm_slli_epi32(
+            _mm_add_epi32(_mm_cvttps_epi32(n), _mm_set1_epi32(127)), 23);
+    return _mm_mul_ps(y, _mm_castsi128_ps(scale));
+}
+
+#endif
+
+static void NsLog1p(const float *in, float *out, size_t length) {
+    size_t i = 0;
+#if defined(NS_MATH_NEON)
+    for (; i + 4 <= length; i += 4) {
+        vst1q_f32(out + i, NsLog1pVector(vld1q_f32(in + i)));
+    }
+#elif defined(NS_MATH_SSE4_1)
+    for (; i + 4 <= length; i += 4) {
+        _mm_storeu_ps(out + i, NsLog1pVector(_mm_loadu_ps(in + i)));
+    }
+#endif
+    for (; i < length; ++i) {
+        out[i] = NsLog1pScalar(in[i]);
+    }
+}
+
+static void NsExp(const float *in, float scale, float *out, size_t length) {
+    size_t i = 0;
+#if defined(NS_MATH_NEON)
+    const float32x4_t s = vdupq_n_f32(scale);
+    for (; i + 4 <= length; i += 4) {
+        vst1q_f32(out + i, NsExpVector(vmulq_f32(s, vld1q_f32(in + i))));
+    }
+#elif defined(NS_MATH_SSE4_1)
+    const __m128 s = _mm_set1_ps(scale);
+    for (; i + 4 <= length; i += 4) {
+        _mm_storeu_ps(out + i,
+                      NsExpVector(_mm_mul_ps(s, _mm_loadu_ps(in + i))));
+    }
+#endif
+    for (; i < length; ++i) {
+        out[i] = NsExpScalar(scale * in[i]);
+    }
+}
+
+#endif  // WEBRTC_MODULES_AUDIO_PROCESSING_NS_NS_MATH_KERNELS_H_
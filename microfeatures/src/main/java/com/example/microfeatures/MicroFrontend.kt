@@ -2,19 +2,109 @@ package com.example.microfeatures
 
 import java.nio.ByteBuffer
 
-data class ProcessOutput(val features: FloatArray, val samplesRead: Int)
-
 class MicroFrontend : AutoCloseable {
     private external fun newNativeFrontend(): Long
     private external fun deleteNativeFrontend(nativeFrontend: Long)
-    private external fun processSamples(nativeFrontend: Long, audio: ByteBuffer): ProcessOutput
+    private external fun addConsumer(nativeFrontend: Long): Int
+    private external fun removeConsumer(nativeFrontend: Long, consumer: Int)
+    private external fun resetConsumer(nativeFrontend: Long, consumer: Int)
+    private external fun addTensorOutput(
+        nativeFrontend: Long,
+        consumer: Int,
+        tensor: ByteBuffer,
+        dataType: Int,
+        scale: Float,
+        zeroPoint: Int
+    ): Int
+    private external fun processSamplesToTensors(
+        nativeFrontend: Long,
+        audio: ByteBuffer,
+        offset: Int,
+        length: Int
+    ): Long
+    private external fun kernelVariant(nativeFrontend: Long): String
+    private external fun saveState(nativeFrontend: Long): ByteArray
+    private external fun restoreState(nativeFrontend: Long, state: ByteArray): Boolean
 
     private var nativeFrontend = newNativeFrontend()
 
-    fun processSamples(audio: ByteBuffer): ProcessOutput {
-        return processSamples(nativeFrontend, audio)
+    /** Native kernel variant picked for this CPU: "scalar", "neon" or "sse4.1". */
+    val kernelVariant: String = kernelVariant(nativeFrontend)
+    private val tensorOutputs = mutableMapOf<Int, MutableList<ByteBuffer>>()
+
+    /**
+     * Registers a consumer, an independent set of model input tensors fed from the
+     * same feature frames (e.g. the wake word models and the stop word models).
+     */
+    fun addConsumer(): Int {
+        val consumer = addConsumer(nativeFrontend)
+        tensorOutputs[consumer] = mutableListOf()
+        return consumer
     }
 
+    /** Unregisters all of [consumer]'s tensors; the consumer id can still be reused. */
+    fun clearConsumer(consumer: Int) {
+        removeConsumer(nativeFrontend, consumer)
+        tensorOutputs[consumer]?.clear()
+    }
+
+    fun removeConsumer(consumer: Int) {
+        removeConsumer(nativeFrontend, consumer)
+        tensorOutputs.remove(consumer)
+    }
+
+    /** Discards the partially accumulated tensors of [consumer] only. */
+    fun resetConsumer(consumer: Int) {
+        resetConsumer(nativeFrontend, consumer)
+    }
+
+    /**
+     * Registers a model input tensor for [consumer] that [processAudioToTensors] quantizes
+     * frames into, using the tensor's [scale] and [zeroPoint]. Frames are appended until
+     * the tensor is full, matching the model's stride. Returns the id used in the ready mask.
+     */
+    fun addTensorOutput(
+        consumer: Int,
+        tensor: ByteBuffer,
+        dataType: Int,
+        scale: Float,
+        zeroPoint: Int
+    ): Int {
+        require(tensor.isDirect) { "Tensor buffer must be a direct ByteBuffer" }
+        val buffers = tensorOutputs[consumer] ?: error("Unknown consumer $consumer")
+        val id = addTensorOutput(nativeFrontend, consumer, tensor, dataType, scale, zeroPoint)
+        check(id >= 0) { "Failed to register tensor output (type $dataType, scale $scale)" }
+        buffers.add(tensor)
+        return id
+    }
+
+    /**
+     * Runs the frontend until at least one registered tensor of any consumer is full or
+     * the audio is exhausted. Each feature frame is computed once for all consumers.
+     * Returns a bit mask of the tensor ids that are ready for inference; they are only
+     * overwritten by the next call, so run the models before calling again.
+     */
+    fun processAudioToTensors(audio: ByteBuffer): Int {
+        require(audio.isDirect) { "Audio buffer must be a direct ByteBuffer" }
+        val result = processSamplesToTensors(nativeFrontend, audio, audio.position(), audio.remaining())
+        val samplesRead = (result and 0xFFFFFFFFL).toInt()
+        audio.position(audio.position() + samplesRead * BYTES_PER_SAMPLE)
+        return (result ushr 32).toInt()
+    }
+
+    /**
+     * Snapshot of the adapted noise estimate and the samples still waiting in the window,
+     * a few kilobytes at most, for [restoreState] on a frontend created later.
+     */
+    fun saveState(): ByteArray = saveState(nativeFrontend)
+
+    /**
+     * Continues from a [saveState] snapshot instead of re-adapting from silence. Returns
+     * false and leaves the frontend as it was if the snapshot came from a different
+     * configuration or native library version.
+     */
+    fun restoreState(state: ByteArray): Boolean = restoreState(nativeFrontend, state)
+
     private fun delete() {
         if (nativeFrontend != -1L) {
             deleteNativeFrontend(nativeFrontend)
@@ -31,11 +121,19 @@ class MicroFrontend : AutoCloseable {
     }
 
     companion object {
-        external fun initJni(processOutputClass: Class<ProcessOutput>)
+        private const val BYTES_PER_SAMPLE = 2
+
+        const val TENSOR_TYPE_FLOAT32 = 0
+        const val TENSOR_TYPE_UINT8 = 1
+        const val TENSOR_TYPE_INT8 = 2
+
+        /** Native memory currently held by all open frontends, in bytes. */
+        external fun nativeBytesInUse(): Long
+
+        external fun liveFrontendCount(): Int
 
         init {
             System.loadLibrary("microfeatures")
-            initJni(ProcessOutput::class.java)
         }
     }
 }
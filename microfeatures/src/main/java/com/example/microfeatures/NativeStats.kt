@@ -0,0 +1,59 @@
+package com.example.microfeatures
+
+import java.io.File
+
+/**
+ * Process-wide timing counters kept by the native frontend and noise
+ * suppressor, summed over every open instance since the last [reset].
+ */
+object NativeStats {
+    enum class Stage {
+        FRONTEND,
+        TENSOR_WRITE,
+        NOISE_PROCESS
+    }
+
+    data class StageStats(
+        val frames: Long,
+        val totalNs: Long,
+        val maxNs: Long,
+        val droppedFrames: Long
+    ) {
+        val meanNs get() = if (frames == 0L) 0L else totalNs / frames
+    }
+
+    private const val FIELDS_PER_STAGE = 4
+
+    private external fun nativeSnapshot(stats: LongArray)
+    private external fun nativeReset()
+    private external fun nativeTracingAvailable(): Boolean
+    private external fun nativeTraceStart()
+    private external fun nativeTraceStopAndWrite(path: String): Long
+
+    init {
+        System.loadLibrary("microfeatures")
+    }
+
+    fun snapshot(): Map<Stage, StageStats> {
+        val values = LongArray(Stage.entries.size * FIELDS_PER_STAGE)
+        nativeSnapshot(values)
+        return Stage.entries.associateWith { stage ->
+            val base = stage.ordinal * FIELDS_PER_STAGE
+            StageStats(values[base], values[base + 1], values[base + 2], values[base + 3])
+        }
+    }
+
+    fun reset() = nativeReset()
+
+    /** Whether the native library was built with -Pmicrofeatures.tracing=true. */
+    val tracingAvailable: Boolean by lazy { nativeTracingAvailable() }
+
+    /** Starts recording native stage spans; they also show up as ATrace sections. */
+    fun startTrace() = nativeTraceStart()
+
+    /**
+     * Stops recording and writes the spans to [file] as Chrome trace JSON, to be opened in
+     * Perfetto. Returns the number of spans written, or -1 if the file could not be written.
+     */
+    fun stopTrace(file: File): Long = nativeTraceStopAndWrite(file.absolutePath)
+}
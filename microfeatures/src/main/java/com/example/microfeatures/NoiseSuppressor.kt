@@ -1,7 +1,6 @@
 package com.example.microfeatures
 
 import java.nio.ByteBuffer
-import java.nio.ByteOrder
 
 class NoiseSuppressor(
     private val sampleRate: Int = 16000,
@@ -15,8 +14,22 @@ class NoiseSuppressor(
     private external fun nativeInit(handle: Long, sampleRate: Int): Int
     private external fun nativeSetPolicy(handle: Long, mode: Int): Int
     private external fun nativeProcess(handle: Long, input: ShortArray, output: ShortArray)
+    private external fun nativeProcessBuffer(
+        handle: Long,
+        input: ByteBuffer,
+        inputOffset: Int,
+        output: ByteBuffer,
+        outputOffset: Int
+    )
+    private external fun nativeProcessStream(
+        handle: Long,
+        buffer: ByteBuffer,
+        offset: Int,
+        numSamples: Int
+    ): Int
     private external fun nativeDestroy(handle: Long)
     private external fun nativeGetSpeechProbability(handle: Long): Float
+    private external fun nativeGetKernelVariant(handle: Long): String
     
     init {
         nativeHandle = nativeCreate()
@@ -28,6 +41,10 @@ class NoiseSuppressor(
             }
         }
     }
+
+    /** Native kernel variant picked for this CPU: "scalar", "neon" or "sse4.1". */
+    val kernelVariant: String =
+        if (nativeHandle != 0L) nativeGetKernelVariant(nativeHandle) else ""
     
     fun process(input: ShortArray, output: ShortArray) {
         if (!isInitialized || nativeHandle == 0L) return
@@ -37,21 +54,45 @@ class NoiseSuppressor(
         nativeProcess(nativeHandle, input, output)
     }
     
-    fun process(inputBuffer: ByteBuffer): ByteBuffer {
-        if (!isInitialized || nativeHandle == 0L) return inputBuffer
-        
-        val inputShorts = ShortArray(FRAME_SIZE)
-        val outputShorts = ShortArray(FRAME_SIZE)
-        val outputBuffer = ByteBuffer.allocateDirect(FRAME_SIZE * 2).order(ByteOrder.LITTLE_ENDIAN)
-        
-        inputBuffer.order(ByteOrder.LITTLE_ENDIAN)
-        inputBuffer.asShortBuffer().get(inputShorts)
-        
-        nativeProcess(nativeHandle, inputShorts, outputShorts)
-        
-        outputBuffer.asShortBuffer().put(outputShorts)
-        outputBuffer.rewind()
-        return outputBuffer
+    /**
+     * Denoises the [FRAME_SIZE] samples at [buffer]'s position in place, e.g. straight in
+     * the buffer returned by `MicrophoneInput.read()`. The buffer must be direct and is
+     * returned with its position and limit unchanged.
+     */
+    fun process(buffer: ByteBuffer): ByteBuffer {
+        process(buffer, buffer)
+        return buffer
+    }
+    
+    /**
+     * Denoises the [FRAME_SIZE] samples at [input]'s position into [output] at its
+     * position without copying either buffer. Both must be direct and may be the same
+     * buffer; positions are not advanced.
+     */
+    fun process(input: ByteBuffer, output: ByteBuffer) {
+        if (!isInitialized || nativeHandle == 0L) return
+        require(input.isDirect && output.isDirect) { "Audio buffers must be direct ByteBuffers" }
+        require(input.remaining() >= FRAME_BYTES && output.remaining() >= FRAME_BYTES) {
+            "Input and output need $FRAME_SIZE samples (10ms at 16kHz) remaining"
+        }
+        nativeProcessBuffer(nativeHandle, input, input.position(), output, output.position())
+    }
+    
+    /**
+     * Denoises every sample between [buffer]'s position and limit in place with a single
+     * native call, so a whole `AudioRecord` read needs no slicing into [FRAME_SIZE] pieces.
+     * Samples short of a full frame are kept natively and come out at the start of the next
+     * call, so the stream stays continuous but may trail the input by up to one frame. The
+     * limit is moved to the end of the denoised samples, whose count is returned; it only
+     * differs from the input count when reads are not multiples of [FRAME_SIZE]. Do not mix
+     * with the single-frame [process] overloads on the same instance.
+     */
+    fun processStream(buffer: ByteBuffer): Int {
+        if (!isInitialized || nativeHandle == 0L) return buffer.remaining() / 2
+        require(buffer.isDirect) { "Audio buffer must be a direct ByteBuffer" }
+        val written = nativeProcessStream(nativeHandle, buffer, buffer.position(), buffer.remaining() / 2)
+        buffer.limit(buffer.position() + written * 2)
+        return written
     }
     
     fun getSpeechProbability(): Float {
@@ -82,6 +123,7 @@ class NoiseSuppressor(
         const val MODE_AGGRESSIVE = 2
         
         const val FRAME_SIZE = 160
+        private const val FRAME_BYTES = FRAME_SIZE * 2
         
         init {
             System.loadLibrary("microfeatures")